@@ -0,0 +1,350 @@
+/*
+ * gipGaugeBenchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGauge.h"
+#include "gipGaugeBatch.h"
+#include "gipGaugeDrawList.h"
+#include "gipGaugeMeshBuilder.h"
+#include "gipGaugeThreadPool.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Reaches the private hot paths of gipGauge, declared a friend in gipGauge.h
+class gipGaugeBenchmark {
+public:
+    struct Result {
+        std::string name;
+        long long iterations;
+        double nanoseconds;     // Per iteration
+        long long items;        // Items processed per iteration, 0 if n/a
+        long long primitives;   // Primitives emitted per iteration, 0 if n/a
+    };
+
+    gipGaugeBenchmark(double minTime, const std::string& filter);
+
+    void runAll();
+    void writeJson(FILE* out) const;
+
+private:
+    double mintime;
+    std::string filter;
+    std::vector<Result> results;
+    volatile float floatsink;
+    volatile size_t sizesink;
+
+    void run(const std::string& name, long long items, long long primitives, const std::function<void()>& body);
+
+    void benchmarkDraw();
+    void benchmarkFormatValue();
+    void benchmarkTickGeometry();
+    void benchmarkUpdateAnimation();
+    void benchmarkZoneLookup();
+    void benchmarkSetValues();
+    void benchmarkDashboard();
+    void benchmarkRelayout();
+
+    static void setupGauge(gipGauge& gauge, gipGauge::GaugeType type, int majorTicks, int minorTicks);
+    static const char* getTypeName(gipGauge::GaugeType type);
+};
+
+gipGaugeBenchmark::gipGaugeBenchmark(double minTime, const std::string& filterText) {
+    mintime = minTime;
+    filter = filterText;
+    floatsink = 0.0f;
+    sizesink = 0;
+}
+
+void gipGaugeBenchmark::run(const std::string& name, long long items, long long primitives, const std::function<void()>& body) {
+    if (!filter.empty() && name.find(filter) == std::string::npos) return;
+
+    // Warm up caches and lazily built geometry
+    body();
+
+    // Double the iteration count until a batch runs for at least mintime
+    long long iterations = 1;
+    double elapsed = 0.0;
+    while (true) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (long long i = 0; i < iterations; i++) body();
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed >= mintime || iterations >= (1LL << 40)) break;
+        iterations *= 2;
+    }
+
+    Result result;
+    result.name = name;
+    result.iterations = iterations;
+    result.nanoseconds = elapsed * 1e9 / iterations;
+    result.items = items;
+    result.primitives = primitives;
+    results.push_back(result);
+    std::fprintf(stderr, "%-48s %14.1f ns %12lld it\n", name.c_str(), result.nanoseconds, iterations);
+}
+
+void gipGaugeBenchmark::setupGauge(gipGauge& gauge, gipGauge::GaugeType type, int majorTicks, int minorTicks) {
+    gauge.setGaugeType(type);
+    gauge.setValueRange(0, 200);
+    gauge.setUnit("km/h");
+    gauge.setMajorTickCount(majorTicks);
+    gauge.setMinorTickCount(minorTicks);
+    gauge.setSafeZone(0, 100);
+    gauge.setWarningZone(100, 150);
+    gauge.setDangerZone(150, 200);
+    gauge.setAnimationEnabled(false);
+    gauge.setValue(120);
+    gauge.update();
+}
+
+const char* gipGaugeBenchmark::getTypeName(gipGauge::GaugeType type) {
+    switch(type) {
+        case gipGauge::GAUGE_CIRCULAR: return "circular";
+        case gipGauge::GAUGE_SEMICIRCLE: return "semicircle";
+        case gipGauge::GAUGE_LINEAR_HORIZONTAL: return "linear_horizontal";
+        case gipGauge::GAUGE_LINEAR_VERTICAL: return "linear_vertical";
+    }
+    return "unknown";
+}
+
+void gipGaugeBenchmark::benchmarkDraw() {
+    const gipGauge::GaugeType types[] = {
+        gipGauge::GAUGE_CIRCULAR, gipGauge::GAUGE_SEMICIRCLE,
+        gipGauge::GAUGE_LINEAR_HORIZONTAL, gipGauge::GAUGE_LINEAR_VERTICAL
+    };
+    const int tickcounts[] = {5, 10, 50, 100};
+
+    for (gipGauge::GaugeType type : types) {
+        for (int ticks : tickcounts) {
+            gipGauge gauge;
+            gipGaugeDrawList drawlist;
+            setupGauge(gauge, type, ticks, 4);
+            gauge.setBackend(&drawlist);
+            gauge.draw(0, 0, 300, 300);
+
+            std::string name = std::string("draw/") + getTypeName(type) + "/ticks:" + std::to_string(ticks);
+            run(name, 1, drawlist.getPrimitiveNum(), [&]() {
+                drawlist.clear();
+                gauge.draw(0, 0, 300, 300);
+            });
+        }
+    }
+}
+
+void gipGaugeBenchmark::benchmarkFormatValue() {
+    gipGauge gauge;
+    float value = 0.0f;
+    char buffer[64];
+    run("formatValue", 1, 0, [&]() {
+        value += 0.37f;
+        if (value > 1000.0f) value = 0.0f;
+        sizesink = gauge.formatValue(value, buffer, sizeof(buffer));
+    });
+}
+
+void gipGaugeBenchmark::benchmarkTickGeometry() {
+    // Regular dials and fine-resolution pressure dials with hundreds of minor ticks
+    const int tickcounts[][2] = {{10, 4}, {10, 19}, {100, 4}};
+    for (const int* ticks : tickcounts) {
+        gipGauge gauge;
+        gipGaugeDrawList drawlist;
+        setupGauge(gauge, gipGauge::GAUGE_CIRCULAR, ticks[0], ticks[1]);
+        gauge.setBackend(&drawlist);
+        gauge.draw(0, 0, 300, 300);
+        std::string name = "tickGeometry/major:" + std::to_string(ticks[0]) + "/minor:" + std::to_string(ticks[1]);
+        run(name, ticks[0] * (ticks[1] + 1) + 1, 0, [&]() {
+            gauge.rebuildTickGeometry();
+            sizesink = gauge.minorticks.size();
+        });
+    }
+}
+
+void gipGaugeBenchmark::benchmarkUpdateAnimation() {
+    gipGauge gauge;
+    gauge.setValueRange(0, 100);
+    bool high = false;
+    run("updateAnimation", 1, 0, [&]() {
+        // Keep the needle in motion so the lerp path is measured
+        high = !high;
+        gauge.targetvalue = high ? 100.0f : 0.0f;
+        gauge.updateAnimation();
+        floatsink = gauge.currentvalue;
+    });
+}
+
+void gipGaugeBenchmark::benchmarkZoneLookup() {
+    gipGauge gauge;
+    setupGauge(gauge, gipGauge::GAUGE_CIRCULAR, 10, 4);
+    float value = 0.0f;
+    run("getZoneColorForValue", 1, 0, [&]() {
+        value += 1.7f;
+        if (value > 200.0f) value = 0.0f;
+        floatsink = gauge.getZoneColorForValue(value).a;
+    });
+}
+
+void gipGaugeBenchmark::benchmarkSetValues() {
+    const int blocksizes[] = {16, 1000, 10000};
+    for (int size : blocksizes) {
+        gipGauge gauge;
+        gauge.setReductionPolicy(gipGauge::REDUCE_RMS);
+        std::vector<float> block(size);
+        for (int i = 0; i < size; i++) block[i] = (i * 37 % 1000) * 0.1f;
+        run("setValues/samples:" + std::to_string(size), size, 0, [&]() {
+            gauge.setValues(block.data(), block.size());
+            gauge.consumeSamples();
+            floatsink = gauge.targetvalue;
+        });
+    }
+}
+
+void gipGaugeBenchmark::benchmarkDashboard() {
+    const int gaugecounts[] = {1, 10, 100, 1000, 10000};
+    const int columns = 100;
+    const int size = 120;
+
+    for (int count : gaugecounts) {
+        std::vector<std::unique_ptr<gipGauge>> gauges;
+        gipGaugeBatch batch;
+        gipGaugeDrawList drawlist;
+        batch.setBackend(&drawlist);
+        for (int i = 0; i < count; i++) {
+            gauges.emplace_back(new gipGauge());
+            setupGauge(*gauges.back(), static_cast<gipGauge::GaugeType>(i % 4), 10, 4);
+            batch.addGauge(gauges.back().get(), (i % columns) * size, (i / columns) * size, size, size);
+        }
+        batch.draw();
+
+        run("dashboard/batch/gauges:" + std::to_string(count), count, drawlist.getPrimitiveNum(), [&]() {
+            drawlist.clear();
+            batch.draw();
+        });
+        run("dashboard/direct/gauges:" + std::to_string(count), count, drawlist.getPrimitiveNum(), [&]() {
+            drawlist.clear();
+            for (int i = 0; i < count; i++) {
+                gauges[i]->setBackend(&drawlist);
+                gauges[i]->draw((i % columns) * size, (i / columns) * size, size, size);
+            }
+        });
+
+        // Single triangle list, grown until the static and dynamic regions fit
+        gipGaugeMeshBuilder mesh;
+        std::vector<gipGaugeMeshBuilder::Vertex> vertices(count * 256);
+        std::vector<uint32_t> indices(count * 512);
+        std::function<void(bool)> drawmesh = [&](bool rebuild) {
+            mesh.begin(rebuild);
+            for (int i = 0; i < count; i++) {
+                gauges[i]->setBackend(&mesh);
+                gauges[i]->draw((i % columns) * size, (i / columns) * size, size, size);
+            }
+            mesh.end();
+        };
+        do {
+            vertices.resize(vertices.size() * 2);
+            indices.resize(indices.size() * 2);
+            mesh.setBuffers(vertices.data(), vertices.size(), indices.data(), indices.size());
+            drawmesh(true);
+        } while (mesh.hasOverflowed());
+
+        run("dashboard/mesh/gauges:" + std::to_string(count), count, 0, [&]() {
+            drawmesh(false);
+        });
+        run("dashboard/mesh_rebuild/gauges:" + std::to_string(count), count, 0, [&]() {
+            drawmesh(true);
+        });
+    }
+}
+
+void gipGaugeBenchmark::benchmarkRelayout() {
+    // Every gauge resized each frame, the worst case for cached geometry
+    const int count = 1000;
+    const int columns = 40;
+    const int size = 120;
+    gipGaugeThreadPool pool;
+    const int threadcounts[] = {1, pool.getThreadNum()};
+
+    for (int threads : threadcounts) {
+        std::vector<std::unique_ptr<gipGauge>> gauges;
+        gipGaugeBatch batch;
+        gipGaugeDrawList drawlist;
+        batch.setBackend(&drawlist);
+        if (threads > 1) batch.setThreadPool(&pool);
+        for (int i = 0; i < count; i++) {
+            gauges.emplace_back(new gipGauge());
+            setupGauge(*gauges.back(), static_cast<gipGauge::GaugeType>(i % 4), 10, 4);
+            gauges.back()->setRetainedMode(true);
+            batch.addGauge(gauges.back().get(), (i % columns) * size, (i / columns) * size, size, size);
+        }
+
+        int frame = 0;
+        run("relayout/gauges:" + std::to_string(count) + "/threads:" + std::to_string(threads), count, 0, [&]() {
+            frame++;
+            for (int i = 0; i < count; i++) {
+                batch.setGaugeRect(gauges[i].get(), (i % columns) * size, (i / columns) * size, size - (frame & 1), size);
+            }
+            drawlist.clear();
+            batch.draw();
+        });
+        if (threads == pool.getThreadNum()) break;
+    }
+}
+
+void gipGaugeBenchmark::runAll() {
+    benchmarkDraw();
+    benchmarkFormatValue();
+    benchmarkTickGeometry();
+    benchmarkUpdateAnimation();
+    benchmarkZoneLookup();
+    benchmarkSetValues();
+    benchmarkDashboard();
+    benchmarkRelayout();
+}
+
+void gipGaugeBenchmark::writeJson(FILE* out) const {
+    // Same top-level layout as Google Benchmark so existing tooling can compare runs
+    std::fprintf(out, "{\n  \"context\": {\n    \"library\": \"gipGauge\",\n    \"min_time\": %g\n  },\n", mintime);
+    std::fprintf(out, "  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        std::fprintf(out, "    {\"name\": \"%s\", \"iterations\": %lld, \"real_time\": %.3f, \"time_unit\": \"ns\"",
+                     r.name.c_str(), r.iterations, r.nanoseconds);
+        if (r.items > 0) std::fprintf(out, ", \"items_per_second\": %.1f", r.items * 1e9 / r.nanoseconds);
+        if (r.primitives > 0) std::fprintf(out, ", \"primitives\": %lld", r.primitives);
+        std::fprintf(out, "}%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n}\n");
+}
+
+int main(int argc, char** argv) {
+    double mintime = 0.2;
+    std::string filter;
+    std::string outpath;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) mintime = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) filter = argv[++i];
+        else if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) outpath = argv[++i];
+        else {
+            std::fprintf(stderr, "usage: %s [--min-time seconds] [--filter substring] [--out file.json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    gipGaugeBenchmark benchmark(mintime, filter);
+    benchmark.runAll();
+
+    FILE* out = outpath.empty() ? stdout : std::fopen(outpath.c_str(), "w");
+    if (out == nullptr) {
+        std::fprintf(stderr, "cannot open %s\n", outpath.c_str());
+        return 1;
+    }
+    benchmark.writeJson(out);
+    if (out != stdout) std::fclose(out);
+    return 0;
+}
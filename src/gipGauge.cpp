@@ -7,17 +7,44 @@
  */
 
 #include "gipGauge.h"
+#include "gipGaugeBackend.h"
+#include "gipGaugeAnimator.h"
+#include "gipGaugeScheduler.h"
+#include "gipGaugeBinary.h"
+#include "gipGaugeGeometry.h"
 #include "gRenderer.h"
 #include <cmath>
 #include <algorithm>
-#include <iomanip>
-#include <sstream>
+#include <cstdio>
+#include <cstring>
+
+static const uint32_t snapshotmagic = 0x53504947;  // "GIPS"
+static const uint32_t snapshotversion = 1;
+
+static void copyColor(float* out, const gColor& color) {
+    out[0] = color.r;
+    out[1] = color.g;
+    out[2] = color.b;
+    out[3] = color.a;
+}
+
+static gColor toColor(const float* in) {
+    return gColor(in[0], in[1], in[2], in[3]);
+}
+
+static void copyText(char* out, size_t size, const std::string& text) {
+    size_t length = std::min(text.size(), size - 1);
+    std::memcpy(out, text.data(), length);
+    std::memset(out + length, 0, size - length);
+}
 
 gipGauge::gipGauge() {
     initializeDefaults();
 }
 
 gipGauge::~gipGauge() {
+    setAnimator(nullptr);
+    setScheduler(nullptr);
 }
 
 void gipGauge::initializeDefaults() {
@@ -32,6 +59,26 @@ void gipGauge::initializeDefaults() {
     gaugestyle = STYLE_MODERN;
     title = "Gauge";
     unit = "";
+    valueprecision = 1;
+    valuetextquantized = 0;
+    valuetextdirty = true;
+
+    // Bulk ingestion
+    blockring.allocate(32);
+    reductionpolicy = REDUCE_LAST;
+    telemetry = nullptr;
+    telemetryslot = -1;
+    telemetrysequence = 0;
+    telemetrystatus = gipGaugeTelemetry::STATUS_ABSENT;
+
+    // History
+    showsparkline = false;
+    sparklinecolor = gColor(0.4f, 0.7f, 1.0f, 0.8f);  // Semi-transparent blue
+    sparklinespan = 0;
+    statsenabled = false;
+    showpeakmarkers = false;
+    peakmarkercolor = gColor(1.0f, 0.5f, 0.1f, 1.0f);   // Orange
+    valleymarkercolor = gColor(0.3f, 0.6f, 1.0f, 1.0f); // Blue
 
     // Colors
     backgroundcolor = gColor(0.2f, 0.2f, 0.2f, 1.0f);  // Dark gray
@@ -44,18 +91,32 @@ void gipGauge::initializeDefaults() {
     safezonecolor = gColor(0.2f, 1.0f, 0.2f, 0.3f);     // Semi-transparent green
 
     // Zone initialization
-    dangerzone = {80.0f, 100.0f, dangerzonecolor, false};
-    warningzone = {60.0f, 80.0f, warningzonecolor, false};
-    safezone = {0.0f, 60.0f, safezonecolor, false};
+    dangerzone = {80.0f, 100.0f, dangerzonecolor, false, ZoneAlarm(), ZONE_DANGER};
+    warningzone = {60.0f, 80.0f, warningzonecolor, false, ZoneAlarm(), ZONE_WARNING};
+    safezone = {0.0f, 60.0f, safezonecolor, false, ZoneAlarm(), ZONE_SAFE};
+    zonetabledirty = true;
+    nextzoneid = 0;
+    zonealarmnum = 0;
+    zonealarmpending = false;
+    alarmsink = nullptr;
 
     // Animation
     animationenabled = true;
     animationspeed = 5.0f;  // Speed factor for smooth transitions
+    hasupdated = false;
     
     // Ticks
     majortickcount = 10;
     minortickcount = 5;  // Minor ticks between each major tick
     showticklabels = true;
+    lod.enabled = false;
+    lod.segmentLength = 10.0f;
+    lod.minSegments = 8;
+    lod.maxSegments = 128;
+    lod.minorTickMinRadius = 40.0f;
+    lod.tickLabelMinRadius = 50.0f;
+    lod.titleMinRadius = 30.0f;
+    lod.cullOverlappingLabels = true;
 
     // Display options
     showvalue = true;
@@ -71,44 +132,348 @@ void gipGauge::initializeDefaults() {
     gaugewidth = gaugeheight = 100;
     centerx = centery = 50.0f;
     radius = 40.0f;
+    geometrydirty = true;
+    retainedmode = false;
+    staticlayerdirty = true;
+    backend = gipGaugeRendererBackend::getDefault();
+#ifdef GIPGAUGE_ENABLE_STATS
+    showcountersoverlay = false;
+#endif
 }
 
 void gipGauge::draw(int x, int y, int w, int h) {
+#ifdef GIPGAUGE_ENABLE_STATS
+    std::chrono::steady_clock::time_point framestart = std::chrono::steady_clock::now();
+    uint64_t allocationstart = gipGaugeCounters::getBufferAllocationNum();
+    gipGaugeBackend* uncounted = backend;
+    countingbackend.begin(backend, &framecounters);
+    backend = &countingbackend;
+#endif
+    setDrawRect(x, y, w, h);
+    
+    // The only branch on the gauge type, the drawing below is resolved per policy
+    switch(gaugetype) {
+        case GAUGE_CIRCULAR:
+            drawGauge<gipGaugeCircularPolicy>();
+            break;
+        case GAUGE_SEMICIRCLE:
+            drawGauge<gipGaugeSemicirclePolicy>();
+            break;
+        case GAUGE_LINEAR_HORIZONTAL:
+            drawGauge<gipGaugeLinearHorizontalPolicy>();
+            break;
+        case GAUGE_LINEAR_VERTICAL:
+            drawGauge<gipGaugeLinearVerticalPolicy>();
+            break;
+    }
+    
+    update();
+
+#ifdef GIPGAUGE_ENABLE_STATS
+    backend = uncounted;
+    framecounters.frames = 1;
+    framecounters.frametime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - framestart).count();
+    framecounters.bufferallocations += gipGaugeCounters::getBufferAllocationNum() - allocationstart;
+    counters.add(framecounters);
+    lastframecounters = framecounters;
+    framecounters.reset();
+    if (showcountersoverlay) gipGaugeCounters::drawOverlay(*backend, lastframecounters, gaugex, gaugey);
+#endif
+}
+
+void gipGauge::setDrawRect(int x, int y, int w, int h) {
+    if (x != gaugex || y != gaugey || w != gaugewidth || h != gaugeheight) {
+        invalidateGeometry();
+    }
     gaugex = x;
     gaugey = y;
     gaugewidth = w;
     gaugeheight = h;
-    
-    // Calculate center and radius based on gauge type
+}
+
+void gipGauge::prepare(int x, int y, int w, int h) {
+    setDrawRect(x, y, w, h);
     switch(gaugetype) {
         case GAUGE_CIRCULAR:
-            centerx = x + w * 0.5f;
-            centery = y + h * 0.5f;
-            radius = std::min(w, h) * 0.4f;
-            drawCircularGauge();
+            prepareGeometry<gipGaugeCircularPolicy>();
             break;
         case GAUGE_SEMICIRCLE:
-            centerx = x + w * 0.5f;
-            centery = y + h * 0.8f;
-            radius = std::min(w, h * 1.25f) * 0.4f;
-            drawSemicircleGauge();
+            prepareGeometry<gipGaugeSemicirclePolicy>();
             break;
         case GAUGE_LINEAR_HORIZONTAL:
-            drawLinearGaugeHorizontal();
+            prepareGeometry<gipGaugeLinearHorizontalPolicy>();
             break;
         case GAUGE_LINEAR_VERTICAL:
-            drawLinearGaugeVertical();
+            prepareGeometry<gipGaugeLinearVerticalPolicy>();
             break;
     }
-    
-    update();
+}
+
+bool gipGauge::needsPrepare(int x, int y, int w, int h) const {
+    if (x != gaugex || y != gaugey || w != gaugewidth || h != gaugeheight || zonetabledirty) return true;
+    bool arcgauge = gaugetype == GAUGE_CIRCULAR || gaugetype == GAUGE_SEMICIRCLE;
+    return (arcgauge && geometrydirty) || (retainedmode && staticlayerdirty);
+}
+
+template<typename Policy>
+void gipGauge::prepareGeometry() {
+    if constexpr (Policy::ARC) {
+        Policy::layout(gaugex, gaugey, gaugewidth, gaugeheight, centerx, centery, radius);
+        if (geometrydirty) rebuildTickGeometry<Policy>();
+    }
+    if (zonetabledirty) rebuildZoneTable();
+    if (retainedmode && staticlayerdirty) recordStaticLayer<Policy>();
+}
+
+const gipGaugeCounters& gipGauge::getCounters() const {
+#ifdef GIPGAUGE_ENABLE_STATS
+    return counters;
+#else
+    return gipGaugeCounters::getEmpty();
+#endif
+}
+
+const gipGaugeCounters& gipGauge::getFrameCounters() const {
+#ifdef GIPGAUGE_ENABLE_STATS
+    return lastframecounters;
+#else
+    return gipGaugeCounters::getEmpty();
+#endif
+}
+
+void gipGauge::resetCounters() {
+#ifdef GIPGAUGE_ENABLE_STATS
+    counters.reset();
+    framecounters.reset();
+    lastframecounters.reset();
+#endif
+}
+
+void gipGauge::setShowCountersOverlay(bool show) {
+#ifdef GIPGAUGE_ENABLE_STATS
+    showcountersoverlay = show;
+#else
+    (void)show;
+#endif
+}
+
+bool gipGauge::getShowCountersOverlay() const {
+#ifdef GIPGAUGE_ENABLE_STATS
+    return showcountersoverlay;
+#else
+    return false;
+#endif
+}
+
+void gipGauge::setBackend(gipGaugeBackend* newbackend) {
+    backend = newbackend ? newbackend : gipGaugeRendererBackend::getDefault();
+}
+
+gipGaugeBackend* gipGauge::getBackend() const {
+    return backend;
 }
 
 void gipGauge::update() {
+    // The scheduler consumes and animates, only while the value moves
+    if (schedulerbinding.scheduler.load(std::memory_order_relaxed)) return;
+    consumeSamples();
     updateAnimation();
 }
 
+void gipGauge::consumeSamples() {
+    // Queued setValue() calls are evaluated at the time they were made
+    TimedSample sample;
+    while (alarmingestion.ring.pop(sample)) {
+        alarmclock = sample.time;
+        recordSample(sample.value);
+    }
+
+    if (zonealarmnum > 0) alarmclock = std::chrono::steady_clock::now();
+    float value;
+    while (samplering.pop(value)) recordSample(value);
+
+    // All blocks of the frame collapse into one displayed value
+    gipGaugeBlockSummary frame, block;
+    while (blockring.pop(block)) frame.merge(block);
+    if (frame.count > 0) recordBlock(frame);
+
+    if (valueslot.consume(value)) recordSample(value);
+
+    if (telemetry) {
+        uint32_t sequence;
+        telemetrystatus = telemetry->read(telemetryslot, value, &sequence);
+        // Only completed writes to the slot since the last frame count as new samples
+        if (telemetrystatus == gipGaugeTelemetry::STATUS_OK && sequence != telemetrysequence) {
+            telemetrysequence = sequence;
+            recordSample(value);
+        }
+    }
+
+    // A dwell runs out with time, even when no new samples arrive
+    if (zonealarmpending) evaluateZoneAlarms(targetvalue);
+}
+
+void gipGauge::recordBlock(const gipGaugeBlockSummary& block) {
+    float value;
+    switch (reductionpolicy) {
+        case REDUCE_MEAN:
+            value = block.sum / block.count;
+            break;
+        case REDUCE_MAX:
+            value = block.max;
+            break;
+        case REDUCE_MIN:
+            value = block.min;
+            break;
+        case REDUCE_RMS:
+            value = std::sqrt(block.sumsquares / block.count);
+            break;
+        default:
+            value = block.last;
+            break;
+    }
+    lastblock = block;
+    // A spike or dip inside the block crosses zones the reduced value may
+    // never reach. Its order within the block is unknown, so both extremes
+    // are checked before the reduced value settles the state.
+    if (zonealarmnum > 0) {
+        evaluateZoneAlarms(std::max(minvalue, std::min(maxvalue, block.min)));
+        evaluateZoneAlarms(std::max(minvalue, std::min(maxvalue, block.max)));
+    }
+    recordSample(value);
+    if (statsenabled) stats.holdExtremes(block.min, block.max);
+}
+
+void gipGauge::recordSample(float value) {
+    history.push(value);
+    if (statsenabled) stats.push(value);
+    targetvalue = std::max(minvalue, std::min(maxvalue, value));
+    if (zonealarmnum > 0) evaluateZoneAlarms(targetvalue);
+}
+
+gipGauge::ValueZone* gipGauge::findZone(int zone) {
+    switch (zone) {
+        case ZONE_DANGER:
+            return &dangerzone;
+        case ZONE_WARNING:
+            return &warningzone;
+        case ZONE_SAFE:
+            return &safezone;
+    }
+    if (zone < 0 || zone >= static_cast<int>(customzones.size())) return nullptr;
+    return &customzones[zone];
+}
+
+const gipGauge::ValueZone* gipGauge::findZone(int zone) const {
+    return const_cast<gipGauge*>(this)->findZone(zone);
+}
+
+void gipGauge::countZoneAlarms() {
+    zonealarmnum = 0;
+    zonealarmpending = false;
+    if (dangerzone.alarm.enabled) zonealarmnum++;
+    if (warningzone.alarm.enabled) zonealarmnum++;
+    if (safezone.alarm.enabled) zonealarmnum++;
+    for (const ValueZone& zone : customzones) {
+        if (zone.alarm.enabled) zonealarmnum++;
+        zonealarmpending |= zone.alarm.pending;
+    }
+    zonealarmpending |= dangerzone.alarm.pending || warningzone.alarm.pending || safezone.alarm.pending;
+
+    // The queue is allocated once and kept, producers may still be pushing
+    if (zonealarmnum > 0 && !alarmingestion.ring.isAllocated()) alarmingestion.ring.allocate(AlarmIngestion::CAPACITY);
+    alarmingestion.enabled.store(zonealarmnum > 0, std::memory_order_release);
+}
+
+void gipGauge::evaluateZoneAlarms(float value) {
+    zonealarmpending = false;
+    evaluateZoneAlarm(dangerzone, ZONE_DANGER, value);
+    evaluateZoneAlarm(warningzone, ZONE_WARNING, value);
+    evaluateZoneAlarm(safezone, ZONE_SAFE, value);
+    for (ValueZone& zone : customzones) evaluateZoneAlarm(zone, zone.id, value);
+}
+
+void gipGauge::evaluateZoneAlarm(ValueZone& zone, int id, float value) {
+    ZoneAlarm& alarm = zone.alarm;
+    if (!alarm.enabled) return;
+    // A pending state that held for the dwell before this value completes
+    // first, at the time its dwell ran out
+    if (alarm.pending && std::chrono::duration<float>(alarmclock - alarm.pendingsince).count() >= alarm.dwell) {
+        alarm.pending = false;
+        alarm.inside = !alarm.inside;
+        std::chrono::steady_clock::time_point time = alarm.pendingsince +
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(alarm.dwell));
+        raiseZoneEvent(id, alarm.inside, alarm.pendingvalue, time);
+    }
+
+    float low = std::min(zone.startValue, zone.endValue);
+    float high = std::max(zone.startValue, zone.endValue);
+    // A disabled zone reads as left
+    bool inside = false;
+    if (zone.enabled) {
+        float margin = alarm.inside ? alarm.hysteresis : 0.0f;
+        inside = value >= low - margin && value <= high + margin;
+    }
+
+    if (inside == alarm.inside) {
+        alarm.pending = false;
+        return;
+    }
+    if (!alarm.pending) {
+        alarm.pending = true;
+        alarm.pendingsince = alarmclock;
+        alarm.pendingvalue = value;
+    }
+    if (std::chrono::duration<float>(alarmclock - alarm.pendingsince).count() < alarm.dwell) {
+        zonealarmpending = true;
+        return;
+    }
+
+    alarm.pending = false;
+    alarm.inside = inside;
+    raiseZoneEvent(id, inside, alarm.pendingvalue, alarmclock);
+}
+
+void gipGauge::raiseZoneEvent(int id, bool entered, float value, std::chrono::steady_clock::time_point time) {
+    gipGaugeZoneEvent event = {this, id, entered, value, time};
+    if (alarmsink) alarmsink->push(event);
+    else zoneevents.push_back(event);
+}
+
 void gipGauge::updateAnimation() {
+    if (animatorbinding.animator) {
+        // The shared animator advances the value, the gauge only feeds it
+        // what changed
+        gipGaugeAnimator* animator = animatorbinding.animator;
+        if (targetvalue != animatorbinding.target) {
+            animator->setTarget(animatorbinding.slot, targetvalue);
+            animatorbinding.target = targetvalue;
+        }
+        if (animationspeed != animatorbinding.speed) {
+            animator->setSpeed(animatorbinding.slot, animationspeed);
+            animatorbinding.speed = animationspeed;
+        }
+        float animated = animator->getCurrent(animatorbinding.slot);
+        if (!animationenabled && animated != targetvalue) {
+            animator->setCurrent(animatorbinding.slot, targetvalue);
+            animated = targetvalue;
+        }
+        animated = std::max(minvalue, std::min(maxvalue, animated));
+        GIPGAUGE_COUNT(if (animated != currentvalue) framecounters.animationsteps++);
+        currentvalue = animated;
+        return;
+    }
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    float deltaTime = 1.0f / 60.0f;
+    if (hasupdated) {
+        deltaTime = std::chrono::duration<float>(now - lastupdatetime).count();
+        deltaTime = std::min(deltaTime, 0.25f);  // Don't jump after stalls
+    }
+    lastupdatetime = now;
+    hasupdated = true;
+
     if (!animationenabled) {
         currentvalue = targetvalue;
         return;
@@ -116,264 +481,397 @@ void gipGauge::updateAnimation() {
     
     float difference = targetvalue - currentvalue;
     if (std::abs(difference) > 0.001f) {
-        float deltaTime = 1.0f / 60.0f;  // Assuming 60 FPS
-        float lerpFactor = animationspeed * deltaTime;
-        currentvalue = lerp(currentvalue, targetvalue, std::min(lerpFactor, 1.0f));
+        GIPGAUGE_COUNT(framecounters.animationsteps++);
+        // Exponential decay covers the same distance per second at any frame rate
+        currentvalue = lerp(currentvalue, targetvalue, 1.0f - std::exp(-animationspeed * deltaTime));
     } else {
         currentvalue = targetvalue;
     }
 }
 
+bool gipGauge::step(float deltaTime) {
+    consumeSamples();
+    if (!animationenabled) {
+        currentvalue = targetvalue;
+    } else {
+        float difference = targetvalue - currentvalue;
+        if (std::abs(difference) > 0.001f) {
+            GIPGAUGE_COUNT(framecounters.animationsteps++);
+            // Exponential decay covers the same distance per second at any frame rate
+            currentvalue += difference * (1.0f - std::exp(-animationspeed * deltaTime));
+        } else {
+            currentvalue = targetvalue;
+        }
+    }
+    // Telemetry is polled, it never announces new values, and a pending
+    // dwell has to be re-checked until it runs out
+    return currentvalue != targetvalue || telemetry != nullptr || zonealarmpending;
+}
+
+void gipGauge::wakeScheduler() {
+    gipGaugeScheduler* scheduler = schedulerbinding.scheduler.load(std::memory_order_acquire);
+    if (scheduler) scheduler->wake(this);
+}
+
+void gipGauge::detachScheduler() {
+    schedulerbinding.scheduler = nullptr;
+    schedulerbinding.index = -1;
+    schedulerbinding.activeindex = -1;
+    schedulerbinding.wakequeued = false;
+}
+
+void gipGauge::detachAnimator() {
+    animatorbinding.animator = nullptr;
+    animatorbinding.slot = -1;
+}
+
 float gipGauge::lerp(float start, float end, float t) {
     return start + t * (end - start);
 }
 
-void gipGauge::drawCircularGauge() {
-    drawBackground();
-    drawZones();
-    drawTicks();
-    if (showneedle) drawNeedle();
-    if (showvalue) drawValueText();
-    if (showtitle) drawTitle();
+void gipGauge::invalidateGeometry() {
+    geometrydirty = true;
+    staticlayerdirty = true;
 }
 
-void gipGauge::drawSemicircleGauge() {
-    drawBackground();
-    drawZones();
-    drawTicks();
-    if (showneedle) drawNeedle();
-    if (showvalue) drawValueText();
-    if (showtitle) drawTitle();
+void gipGauge::invalidateStaticLayer() {
+    staticlayerdirty = true;
 }
 
-void gipGauge::drawLinearGaugeHorizontal() {
-    // Draw background rectangle
-    renderer->setColor(backgroundcolor);
-    renderer->drawRectangle(gaugex, gaugey, gaugewidth, gaugeheight, true);
-    
-    // Draw zones
-    drawZones();
-    
-    // Draw value bar
-    float valueRatio = (currentvalue - minvalue) / (maxvalue - minvalue);
-    valueRatio = std::max(0.0f, std::min(1.0f, valueRatio));
-    
-    gColor valueColor = getZoneColorForValue(currentvalue);
-    if (valueColor.r == 0 && valueColor.g == 0 && valueColor.b == 0) {
-        valueColor = needlecolor;
+void gipGauge::invalidateZones() {
+    zonetabledirty = true;
+    staticlayerdirty = true;
+}
+
+void gipGauge::rebuildTickGeometry() {
+    if (gaugetype == GAUGE_SEMICIRCLE) rebuildTickGeometry<gipGaugeSemicirclePolicy>();
+    else if (gaugetype == GAUGE_CIRCULAR) rebuildTickGeometry<gipGaugeCircularPolicy>();
+}
+
+template<typename Policy>
+void gipGauge::rebuildTickGeometry() {
+    majorticks.clear();
+    minorticks.clear();
+    ticklabels.clear();
+
+    // Evenly spaced ticks, their angles form a single progression. Without a
+    // range every major tick sits at the end, as in the value mapping.
+    bool degenerate = maxvalue == minvalue;
+    double startAngle = degenerate ? Policy::START_ANGLE + Policy::SWEEP_ANGLE : Policy::START_ANGLE;
+    double majorStep = degenerate ? 0.0 : static_cast<double>(Policy::SWEEP_ANGLE) / majortickcount;
+    int majorCount = majortickcount + 1;
+    tickcosines.resize(majorCount);
+    ticksines.resize(majorCount);
+    gipGaugeTickKernel::directions(startAngle, majorStep, majorCount, tickcosines.data(), ticksines.data());
+    gipGaugeTickKernel::endpoints(tickcosines.data(), ticksines.data(), majorCount,
+                                  centerx, centery, radius * 0.85f, radius * 0.95f, majorticks);
+
+    ticklabels.reserve(majorCount);
+    float labelRadius = radius * 0.75f;
+    char label[32];
+    for (int i = 0; i < majorCount; i++) {
+        float value = minvalue + (maxvalue - minvalue) * i / majortickcount;
+        formatValue(value, label, sizeof(label));
+        ticklabels.push_back({centerx + labelRadius * tickcosines[i] - 10, centery + labelRadius * ticksines[i] - 5, label, true});
+    }
+
+    if (lod.enabled && lod.cullOverlappingLabels) cullOverlappingLabels();
+
+    // Minor ticks need an increasing range, and are dropped entirely on small gauges
+    if (!(maxvalue > minvalue) || minortickcount == 0 || (lod.enabled && radius < lod.minorTickMinRadius)) {
+        geometrydirty = false;
+        return;
+    }
+
+    // One fine progression through all ticks, the major positions are skipped
+    int stride = minortickcount + 1;
+    int fineCount = majortickcount * stride;
+    tickcosines.resize(fineCount);
+    ticksines.resize(fineCount);
+    gipGaugeTickKernel::directions(startAngle, majorStep / stride, fineCount, tickcosines.data(), ticksines.data());
+    int minorCount = 0;
+    for (int i = 0; i < fineCount; i++) {
+        if (i % stride == 0) continue;
+        tickcosines[minorCount] = tickcosines[i];
+        ticksines[minorCount] = ticksines[i];
+        minorCount++;
+    }
+    gipGaugeTickKernel::endpoints(tickcosines.data(), ticksines.data(), minorCount,
+                                  centerx, centery, radius * 0.9f, radius * 0.95f, minorticks);
+
+    geometrydirty = false;
+}
+
+void gipGauge::cullOverlappingLabels() {
+    // Greedy sweep along the arc, a label is kept if it clears the last kept
+    // label and, on the wrapping circular gauge, the first one
+    int first = -1;
+    int last = -1;
+    float firstw = 0, firsth = 0, lastw = 0, lasth = 0;
+    for (size_t i = 0; i < ticklabels.size(); i++) {
+        TickLabel& label = ticklabels[i];
+        float w, h;
+        backend->measureText(label.text, gFont::FONT_SIZE_SMALL, w, h);
+
+        bool overlaps = false;
+        if (last >= 0) {
+            const TickLabel& other = ticklabels[last];
+            overlaps = label.x < other.x + lastw && other.x < label.x + w &&
+                       label.y < other.y + lasth && other.y < label.y + h;
+        }
+        if (!overlaps && first >= 0 && first != last) {
+            const TickLabel& other = ticklabels[first];
+            overlaps = label.x < other.x + firstw && other.x < label.x + w &&
+                       label.y < other.y + firsth && other.y < label.y + h;
+        }
+
+        label.visible = !overlaps;
+        if (label.visible) {
+            if (first < 0) {
+                first = i;
+                firstw = w;
+                firsth = h;
+            }
+            last = i;
+            lastw = w;
+            lasth = h;
+        }
     }
-    
-    renderer->setColor(valueColor);
-    int barWidth = static_cast<int>(gaugewidth * valueRatio);
-    renderer->drawRectangle(gaugex, gaugey, barWidth, gaugeheight, true);
-    
-    // Draw border
-    renderer->setColor(tickcolor);
-    renderer->drawRectangle(gaugex, gaugey, gaugewidth, gaugeheight, false);
-    
-    if (showvalue) drawValueText();
-    if (showtitle) drawTitle();
 }
 
-void gipGauge::drawLinearGaugeVertical() {
-    // Draw background rectangle
-    renderer->setColor(backgroundcolor);
-    renderer->drawRectangle(gaugex, gaugey, gaugewidth, gaugeheight, true);
-    
-    // Draw zones
-    drawZones();
-    
-    // Draw value bar
-    float valueRatio = (currentvalue - minvalue) / (maxvalue - minvalue);
-    valueRatio = std::max(0.0f, std::min(1.0f, valueRatio));
-    
-    gColor valueColor = getZoneColorForValue(currentvalue);
-    if (valueColor.r == 0 && valueColor.g == 0 && valueColor.b == 0) {
-        valueColor = needlecolor;
+int gipGauge::getArcSegments(float arcRadius, float sweepAngle, int defaultSegments) {
+    if (!lod.enabled) return defaultSegments;
+    float arcLength = arcRadius * std::abs(sweepAngle) * M_PI / 180.0f;
+    int segments = static_cast<int>(std::ceil(arcLength / lod.segmentLength));
+    return std::max(lod.minSegments, std::min(lod.maxSegments, segments));
+}
+
+template<typename Policy>
+void gipGauge::drawGauge() {
+    if constexpr (Policy::ARC) {
+        Policy::layout(gaugex, gaugey, gaugewidth, gaugeheight, centerx, centery, radius);
+        drawStaticLayer<Policy>();
+        if (showsparkline) drawSparkline<Policy>();
+        if (showpeakmarkers) drawPeakMarkers<Policy>();
+        if (showneedle) drawNeedle<Policy>();
+    } else {
+        // Draw background rectangle and zones
+        drawStaticLayer<Policy>();
+
+        // Draw value bar, counted as the needle stage
+        {
+            GIPGAUGE_STAGE_TIMER(framecounters, STAGE_NEEDLE);
+            backend->setLayer(gipGaugeBackend::LAYER_NEEDLE);
+            float valueRatio = valueToRatio(currentvalue);
+
+            gColor valueColor = getZoneColorForValue(currentvalue);
+            if (valueColor.r == 0 && valueColor.g == 0 && valueColor.b == 0) {
+                valueColor = needlecolor;
+            }
+
+            backend->setColor(valueColor);
+            if constexpr (Policy::HORIZONTAL) {
+                int barWidth = static_cast<int>(gaugewidth * valueRatio);
+                backend->drawRectangle(gaugex, gaugey, barWidth, gaugeheight, true);
+            } else {
+                int barHeight = static_cast<int>(gaugeheight * valueRatio);
+                backend->drawRectangle(gaugex, gaugey + gaugeheight - barHeight, gaugewidth, barHeight, true);
+            }
+        }
+        if (showsparkline) drawSparkline<Policy>();
+        if (showpeakmarkers) drawPeakMarkers<Policy>();
+
+        // Draw border
+        backend->setColor(tickcolor);
+        backend->drawRectangle(gaugex, gaugey, gaugewidth, gaugeheight, false);
     }
-    
-    renderer->setColor(valueColor);
-    int barHeight = static_cast<int>(gaugeheight * valueRatio);
-    renderer->drawRectangle(gaugex, gaugey + gaugeheight - barHeight, gaugewidth, barHeight, true);
-    
-    // Draw border
-    renderer->setColor(tickcolor);
-    renderer->drawRectangle(gaugex, gaugey, gaugewidth, gaugeheight, false);
-    
-    if (showvalue) drawValueText();
-    if (showtitle) drawTitle();
+    if (showvalue) drawValueText<Policy>();
+    if (showtitle) drawTitle<Policy>();
 }
 
+template<typename Policy>
+void gipGauge::drawStaticLayer() {
+    if (!retainedmode) {
+        drawBackground<Policy>();
+        drawZones<Policy>();
+        if constexpr (Policy::ARC) drawTicks<Policy>();
+        return;
+    }
+
+    // Record once, then replay until a visual setter or the rect changes
+    if (staticlayerdirty) recordStaticLayer<Policy>();
+    backend->drawRetained(staticlayer);
+}
+
+template<typename Policy>
+void gipGauge::recordStaticLayer() {
+    // Labels are culled against the real backend's text metrics, so the tick
+    // geometry is rebuilt before the recording list takes its place
+    if constexpr (Policy::ARC) {
+        if (geometrydirty) rebuildTickGeometry<Policy>();
+    }
+    gipGaugeBackend* previous = backend;
+    staticlayer.clear();
+    backend = &staticlayer;
+    drawBackground<Policy>();
+    drawZones<Policy>();
+    if constexpr (Policy::ARC) drawTicks<Policy>();
+    backend = previous;
+    staticlayerdirty = false;
+}
+
+template<typename Policy>
 void gipGauge::drawBackground() {
-    renderer->setColor(backgroundcolor);
-    if (gaugetype == GAUGE_SEMICIRCLE) {
-        renderer->drawArc(centerx, centery, radius, 180.0f, 360.0f, true, 64);
+    GIPGAUGE_STAGE_TIMER(framecounters, STAGE_BACKGROUND);
+    backend->setLayer(gipGaugeBackend::LAYER_BACKGROUND);
+    backend->setColor(backgroundcolor);
+    if constexpr (!Policy::ARC) {
+        backend->drawRectangle(gaugex, gaugey, gaugewidth, gaugeheight, true);
+    } else if constexpr (Policy::FULL_DIAL) {
+        backend->drawCircle(centerx, centery, radius, true, getArcSegments(radius, 360.0f, 64));
     } else {
-        renderer->drawCircle(centerx, centery, radius, true, 64);
+        backend->drawArc(centerx, centery, radius, Policy::START_ANGLE, Policy::START_ANGLE + Policy::SWEEP_ANGLE,
+                         true, getArcSegments(radius, Policy::SWEEP_ANGLE, 64));
     }
 }
 
+template<typename Policy>
 void gipGauge::drawZones() {
-    if (gaugetype == GAUGE_LINEAR_HORIZONTAL) {
-        if (safezone.enabled) {
-            float startRatio = (safezone.startValue - minvalue) / (maxvalue - minvalue);
-            float endRatio = (safezone.endValue - minvalue) / (maxvalue - minvalue);
-            startRatio = std::max(0.0f, std::min(1.0f, startRatio));
-            endRatio = std::max(0.0f, std::min(1.0f, endRatio));
-            
-            renderer->setColor(safezone.color);
-            int startX = gaugex + static_cast<int>(gaugewidth * startRatio);
-            int width = static_cast<int>(gaugewidth * (endRatio - startRatio));
-            renderer->drawRectangle(startX, gaugey, width, gaugeheight, true);
-        }
-        
-        if (warningzone.enabled) {
-            float startRatio = (warningzone.startValue - minvalue) / (maxvalue - minvalue);
-            float endRatio = (warningzone.endValue - minvalue) / (maxvalue - minvalue);
-            startRatio = std::max(0.0f, std::min(1.0f, startRatio));
-            endRatio = std::max(0.0f, std::min(1.0f, endRatio));
-            
-            renderer->setColor(warningzone.color);
-            int startX = gaugex + static_cast<int>(gaugewidth * startRatio);
-            int width = static_cast<int>(gaugewidth * (endRatio - startRatio));
-            renderer->drawRectangle(startX, gaugey, width, gaugeheight, true);
-        }
-        
-        if (dangerzone.enabled) {
-            float startRatio = (dangerzone.startValue - minvalue) / (maxvalue - minvalue);
-            float endRatio = (dangerzone.endValue - minvalue) / (maxvalue - minvalue);
-            startRatio = std::max(0.0f, std::min(1.0f, startRatio));
-            endRatio = std::max(0.0f, std::min(1.0f, endRatio));
-            
-            renderer->setColor(dangerzone.color);
-            int startX = gaugex + static_cast<int>(gaugewidth * startRatio);
-            int width = static_cast<int>(gaugewidth * (endRatio - startRatio));
-            renderer->drawRectangle(startX, gaugey, width, gaugeheight, true);
-        }
-    } else if (gaugetype == GAUGE_LINEAR_VERTICAL) {
-        if (safezone.enabled) {
-            float startRatio = (safezone.startValue - minvalue) / (maxvalue - minvalue);
-            float endRatio = (safezone.endValue - minvalue) / (maxvalue - minvalue);
-            startRatio = std::max(0.0f, std::min(1.0f, startRatio));
-            endRatio = std::max(0.0f, std::min(1.0f, endRatio));
-            
-            renderer->setColor(safezone.color);
-            int startY = gaugey + static_cast<int>(gaugeheight * (1.0f - endRatio));
-            int height = static_cast<int>(gaugeheight * (endRatio - startRatio));
-            renderer->drawRectangle(gaugex, startY, gaugewidth, height, true);
-        }
-        
-        if (warningzone.enabled) {
-            float startRatio = (warningzone.startValue - minvalue) / (maxvalue - minvalue);
-            float endRatio = (warningzone.endValue - minvalue) / (maxvalue - minvalue);
-            startRatio = std::max(0.0f, std::min(1.0f, startRatio));
-            endRatio = std::max(0.0f, std::min(1.0f, endRatio));
-            
-            renderer->setColor(warningzone.color);
-            int startY = gaugey + static_cast<int>(gaugeheight * (1.0f - endRatio));
-            int height = static_cast<int>(gaugeheight * (endRatio - startRatio));
-            renderer->drawRectangle(gaugex, startY, gaugewidth, height, true);
-        }
-        
-        if (dangerzone.enabled) {
-            float startRatio = (dangerzone.startValue - minvalue) / (maxvalue - minvalue);
-            float endRatio = (dangerzone.endValue - minvalue) / (maxvalue - minvalue);
-            startRatio = std::max(0.0f, std::min(1.0f, startRatio));
-            endRatio = std::max(0.0f, std::min(1.0f, endRatio));
-            
-            renderer->setColor(dangerzone.color);
-            int startY = gaugey + static_cast<int>(gaugeheight * (1.0f - endRatio));
-            int height = static_cast<int>(gaugeheight * (endRatio - startRatio));
-            renderer->drawRectangle(gaugex, startY, gaugewidth, height, true);
-        }
-    } else {
-        // Draw circular/semicircular zones
-        if (safezone.enabled) {
-            float startAngle = valueToAngle(safezone.startValue);
-            float endAngle = valueToAngle(safezone.endValue);
-            renderer->setColor(safezone.color);
-            renderer->drawArc(centerx, centery, radius * 0.9f, startAngle, endAngle, true, 32);
-        }
-        
-        if (warningzone.enabled) {
-            float startAngle = valueToAngle(warningzone.startValue);
-            float endAngle = valueToAngle(warningzone.endValue);
-            renderer->setColor(warningzone.color);
-            renderer->drawArc(centerx, centery, radius * 0.9f, startAngle, endAngle, true, 32);
-        }
-        
-        if (dangerzone.enabled) {
-            float startAngle = valueToAngle(dangerzone.startValue);
-            float endAngle = valueToAngle(dangerzone.endValue);
-            renderer->setColor(dangerzone.color);
-            renderer->drawArc(centerx, centery, radius * 0.9f, startAngle, endAngle, true, 32);
+    GIPGAUGE_STAGE_TIMER(framecounters, STAGE_ZONES);
+    typedef gipGaugeGeometry<Policy> geometry;
+    backend->setLayer(gipGaugeBackend::LAYER_ZONES);
+    if (zonetabledirty) rebuildZoneTable();
+
+    for (const ZoneSegment& segment : zonetable) {
+        backend->setColor(segment.color);
+        if constexpr (Policy::ARC) {
+            float startAngle = geometry::valueToAngle(segment.startValue, minvalue, maxvalue);
+            float endAngle = geometry::valueToAngle(segment.endValue, minvalue, maxvalue);
+            backend->drawArc(centerx, centery, radius * 0.9f, startAngle, endAngle, true,
+                             getArcSegments(radius * 0.9f, endAngle - startAngle, 32));
+        } else {
+            float startRatio = geometry::valueToRatio(segment.startValue, minvalue, maxvalue);
+            float endRatio = geometry::valueToRatio(segment.endValue, minvalue, maxvalue);
+            if constexpr (Policy::HORIZONTAL) {
+                int startX = gaugex + static_cast<int>(gaugewidth * startRatio);
+                int width = static_cast<int>(gaugewidth * (endRatio - startRatio));
+                backend->drawRectangle(startX, gaugey, width, gaugeheight, true);
+            } else {
+                int startY = gaugey + static_cast<int>(gaugeheight * (1.0f - endRatio));
+                int height = static_cast<int>(gaugeheight * (endRatio - startRatio));
+                backend->drawRectangle(gaugex, startY, gaugewidth, height, true);
+            }
         }
     }
 }
 
+template<typename Policy>
 void gipGauge::drawTicks() {
-    if (gaugetype == GAUGE_LINEAR_HORIZONTAL || gaugetype == GAUGE_LINEAR_VERTICAL) {
-        // Linear gauge ticks can be implemented here if needed
-        return;
-    }
-    
-    renderer->setColor(tickcolor);
-    
+    GIPGAUGE_STAGE_TIMER(framecounters, STAGE_TICKS);
+    if (geometrydirty) rebuildTickGeometry<Policy>();
+
+    backend->setLayer(gipGaugeBackend::LAYER_TICKS);
+    backend->setColor(tickcolor);
+
     // Draw major ticks
-    std::vector<float> majorTickValues = generateTickValues(true);
-    for (float value : majorTickValues) {
-        float angle = valueToAngle(value);
-        float cos_a = std::cos(angle * M_PI / 180.0f);
-        float sin_a = std::sin(angle * M_PI / 180.0f);
-        
-        float innerRadius = radius * 0.85f;
-        float outerRadius = radius * 0.95f;
-        
-        float x1 = centerx + innerRadius * cos_a;
-        float y1 = centery + innerRadius * sin_a;
-        float x2 = centerx + outerRadius * cos_a;
-        float y2 = centery + outerRadius * sin_a;
-        
-        renderer->drawLine(x1, y1, x2, y2);
-        
-        // Draw tick labels
-        if (showticklabels) {
-            std::string label = formatValue(value);
-            float labelRadius = radius * 0.75f;
-            float labelX = centerx + labelRadius * cos_a;
-            float labelY = centery + labelRadius * sin_a;
-            
-            renderer->drawText(label, labelX - 10, labelY - 5, gFont::FONT_SIZE_SMALL);
+    for (int i = 0; i < majorticks.size(); i++) {
+        backend->drawLine(majorticks.x1[i], majorticks.y1[i], majorticks.x2[i], majorticks.y2[i]);
+    }
+
+    // Draw tick labels
+    if (showticklabels && (!lod.enabled || radius >= lod.tickLabelMinRadius)) {
+        for (const TickLabel& label : ticklabels) {
+            if (label.visible) backend->drawText(label.text, label.x, label.y, gFont::FONT_SIZE_SMALL);
         }
     }
-    
+
     // Draw minor ticks
-    std::vector<float> minorTickValues = generateTickValues(false);
-    for (float value : minorTickValues) {
-        float angle = valueToAngle(value);
-        float cos_a = std::cos(angle * M_PI / 180.0f);
-        float sin_a = std::sin(angle * M_PI / 180.0f);
-        
-        float innerRadius = radius * 0.9f;
-        float outerRadius = radius * 0.95f;
-        
-        float x1 = centerx + innerRadius * cos_a;
-        float y1 = centery + innerRadius * sin_a;
-        float x2 = centerx + outerRadius * cos_a;
-        float y2 = centery + outerRadius * sin_a;
-        
-        renderer->drawLine(x1, y1, x2, y2);
+    for (int i = 0; i < minorticks.size(); i++) {
+        backend->drawLine(minorticks.x1[i], minorticks.y1[i], minorticks.x2[i], minorticks.y2[i]);
     }
 }
 
-void gipGauge::drawNeedle() {
-    if (gaugetype == GAUGE_LINEAR_HORIZONTAL || gaugetype == GAUGE_LINEAR_VERTICAL) {
-        return;  // Linear gauges don't have needles
+template<typename Policy>
+void gipGauge::drawSparkline() {
+    if (!history.isAllocated() || history.getSampleNum() == 0) return;
+
+    float sparkX, sparkY, sparkW, sparkH;
+    if constexpr (Policy::ARC) {
+        sparkX = centerx - radius * 0.5f;
+        sparkY = centery + radius * Policy::SPARKLINE_Y;
+        sparkW = radius;
+        sparkH = radius * Policy::SPARKLINE_H;
+    } else {
+        // Across the whole bar, time runs left to right on both orientations
+        sparkX = gaugex;
+        sparkY = gaugey;
+        sparkW = gaugewidth;
+        sparkH = gaugeheight;
     }
+
+    // One min/max column per pixel
+    int columns = std::max(1, static_cast<int>(sparkW));
+    if (static_cast<int>(sparklinemin.size()) < columns) {
+        sparklinemin.resize(columns);
+        sparklinemax.resize(columns);
+    }
+    int64_t span = sparklinespan > 0 ? sparklinespan : history.getSpan();
+    int written = history.decimate(span, columns, sparklinemin.data(), sparklinemax.data());
+    if (written == 0) return;
+
+    backend->setLayer(gipGaugeBackend::LAYER_NEEDLE);
+    backend->setColor(sparklinecolor);
+    float step = sparkW / written;
+    float bottom = sparkY + sparkH;
+    for (int c = 0; c < written; c++) {
+        // Stretch each column to touch the previous one so the line stays connected
+        float low = sparklinemin[c];
+        float high = sparklinemax[c];
+        if (c > 0) {
+            low = std::min(low, sparklinemax[c - 1]);
+            high = std::max(high, sparklinemin[c - 1]);
+        }
+        float x = sparkX + step * (c + 0.5f);
+        backend->drawLine(x, bottom - sparkH * valueToRatio(low), x, bottom - sparkH * valueToRatio(high));
+    }
+}
+
+template<typename Policy>
+void gipGauge::drawPeakMarkers() {
+    if (stats.getSampleNum() == 0) return;
+    backend->setLayer(gipGaugeBackend::LAYER_NEEDLE);
+    backend->setColor(peakmarkercolor);
+    drawMarker<Policy>(stats.getPeak());
+    backend->setColor(valleymarkercolor);
+    drawMarker<Policy>(stats.getValley());
+}
+
+template<typename Policy>
+void gipGauge::drawMarker(float value) {
+    typedef gipGaugeGeometry<Policy> geometry;
+    if constexpr (Policy::ARC) {
+        // Short radial mark across the zone band
+        float angle = geometry::valueToAngle(value, minvalue, maxvalue) * M_PI / 180.0f;
+        float cos_a = std::cos(angle);
+        float sin_a = std::sin(angle);
+        backend->drawLine(centerx + radius * 0.75f * cos_a, centery + radius * 0.75f * sin_a,
+                          centerx + radius * cos_a, centery + radius * sin_a);
+    } else if constexpr (Policy::HORIZONTAL) {
+        float x = gaugex + gaugewidth * geometry::valueToRatio(value, minvalue, maxvalue);
+        backend->drawLine(x, gaugey, x, gaugey + gaugeheight);
+    } else {
+        float y = gaugey + gaugeheight * (1.0f - geometry::valueToRatio(value, minvalue, maxvalue));
+        backend->drawLine(gaugex, y, gaugex + gaugewidth, y);
+    }
+}
+
+template<typename Policy>
+void gipGauge::drawNeedle() {
+    GIPGAUGE_STAGE_TIMER(framecounters, STAGE_NEEDLE);
+    backend->setLayer(gipGaugeBackend::LAYER_NEEDLE);
+    backend->setColor(needlecolor);
     
-    renderer->setColor(needlecolor);
-    
-    float angle = valueToAngle(currentvalue);
+    float angle = gipGaugeGeometry<Policy>::valueToAngle(currentvalue, minvalue, maxvalue);
     float cos_a = std::cos(angle * M_PI / 180.0f);
     float sin_a = std::sin(angle * M_PI / 180.0f);
     
@@ -382,130 +880,318 @@ void gipGauge::drawNeedle() {
     float needleEndY = centery + needleEndRadius * sin_a;
     
     // Draw needle line
-    renderer->drawLine(centerx, centery, needleEndX, needleEndY);
+    backend->drawLine(centerx, centery, needleEndX, needleEndY);
     
     // Draw center dot
-    renderer->drawCircle(centerx, centery, 3, true);
+    backend->drawCircle(centerx, centery, 3, true, 32);
 }
 
+template<typename Policy>
 void gipGauge::drawValueText() {
-    renderer->setColor(valuetextcolor);
+    GIPGAUGE_STAGE_TIMER(framecounters, STAGE_VALUETEXT);
+    backend->setLayer(gipGaugeBackend::LAYER_TEXT);
+    backend->setColor(valuetextcolor);
     
-    std::string valueText = formatValue(currentvalue);
-    if (!unit.empty()) {
-        valueText += " " + unit;
+    // Skip formatting while the displayed digits stay the same
+    static const double scales[] = {1.0, 10.0, 100.0, 1e3, 1e4, 1e5, 1e6};
+    double scaled = currentvalue * scales[valueprecision];
+    bool quantizable = std::abs(scaled) < 1e15;
+    long long quantized = quantizable ? std::llround(scaled) : 0;
+    if (valuetextdirty || !quantizable || quantized != valuetextquantized) {
+        char buffer[64];
+        int length = formatValue(currentvalue, buffer, sizeof(buffer));
+        // assign() reuses the string's capacity, no allocation once warmed up
+        valuetext.assign(buffer, length);
+        if (!unit.empty()) {
+            valuetext.push_back(' ');
+            valuetext.append(unit);
+        }
+        valuetextquantized = quantized;
+        valuetextdirty = false;
     }
     
     float textX, textY;
-    if (gaugetype == GAUGE_SEMICIRCLE) {
+    if constexpr (Policy::ARC) {
         textX = centerx - 20;
-        textY = centery - 20;
-    } else if (gaugetype == GAUGE_LINEAR_HORIZONTAL) {
-        textX = gaugex + gaugewidth * 0.5f - 20;
-        textY = gaugey + gaugeheight * 0.5f;
-    } else if (gaugetype == GAUGE_LINEAR_VERTICAL) {
+        textY = centery + Policy::VALUE_TEXT_Y;
+    } else {
         textX = gaugex + gaugewidth * 0.5f - 20;
         textY = gaugey + gaugeheight * 0.5f;
-    } else {  // GAUGE_CIRCULAR
-        textX = centerx - 20;
-        textY = centery + 10;
     }
     
-    renderer->drawText(valueText, textX, textY, gFont::FONT_SIZE_MEDIUM);
+    backend->drawValueText(valuetext, textX, textY, gFont::FONT_SIZE_MEDIUM);
 }
 
+template<typename Policy>
 void gipGauge::drawTitle() {
-    renderer->setColor(titlecolor);
+    GIPGAUGE_STAGE_TIMER(framecounters, STAGE_TITLE);
+    if (lod.enabled && Policy::ARC && radius < lod.titleMinRadius) return;
+
+    backend->setLayer(gipGaugeBackend::LAYER_TEXT);
+    backend->setColor(titlecolor);
     
     float titleX, titleY;
-    if (gaugetype == GAUGE_SEMICIRCLE) {
+    if constexpr (Policy::ARC) {
         titleX = centerx - title.length() * 3;
         titleY = gaugey + 15;
-    } else if (gaugetype == GAUGE_LINEAR_HORIZONTAL) {
-        titleX = gaugex + 5;
-        titleY = gaugey - 5;
-    } else if (gaugetype == GAUGE_LINEAR_VERTICAL) {
+    } else {
         titleX = gaugex + 5;
         titleY = gaugey - 5;
-    } else {  // GAUGE_CIRCULAR
-        titleX = centerx - title.length() * 3;
-        titleY = gaugey + 15;
     }
     
-    renderer->drawText(title, titleX, titleY, gFont::FONT_SIZE_SMALL);
+    backend->drawText(title, titleX, titleY, gFont::FONT_SIZE_SMALL);
 }
 
-float gipGauge::valueToAngle(float value) {
+float gipGauge::valueToRatio(float value) {
     float valueRatio = (value - minvalue) / (maxvalue - minvalue);
-    valueRatio = std::max(0.0f, std::min(1.0f, valueRatio));
-    
-    if (gaugetype == GAUGE_SEMICIRCLE) {
-        return 180.0f + valueRatio * 180.0f;  // 180° to 360° (bottom semicircle)
-    } else {
-        return 225.0f + valueRatio * 270.0f;  // 225° to 495° (3/4 circle, starting from bottom-left)
-    }
+    return std::max(0.0f, std::min(1.0f, valueRatio));
+}
+
+// Runtime mapping for callers without a policy, linear gauges share the circular sweep
+float gipGauge::valueToAngle(float value) {
+    if (gaugetype == GAUGE_SEMICIRCLE) return gipGaugeGeometry<gipGaugeSemicirclePolicy>::valueToAngle(value, minvalue, maxvalue);
+    return gipGaugeGeometry<gipGaugeCircularPolicy>::valueToAngle(value, minvalue, maxvalue);
 }
 
 float gipGauge::angleToValue(float angle) {
-    float normalizedAngle;
-    if (gaugetype == GAUGE_SEMICIRCLE) {
-        normalizedAngle = (angle - 180.0f) / 180.0f;
-    } else {
-        normalizedAngle = (angle - 225.0f) / 270.0f;
-    }
-    
-    normalizedAngle = std::max(0.0f, std::min(1.0f, normalizedAngle));
-    return minvalue + normalizedAngle * (maxvalue - minvalue);
+    if (gaugetype == GAUGE_SEMICIRCLE) return gipGaugeGeometry<gipGaugeSemicirclePolicy>::angleToValue(angle, minvalue, maxvalue);
+    return gipGaugeGeometry<gipGaugeCircularPolicy>::angleToValue(angle, minvalue, maxvalue);
 }
 
 gColor gipGauge::getZoneColorForValue(float value) {
-    if (dangerzone.enabled && value >= dangerzone.startValue && value <= dangerzone.endValue) {
-        return dangerzonecolor;
-    }
-    if (warningzone.enabled && value >= warningzone.startValue && value <= warningzone.endValue) {
-        return warningzonecolor;
-    }
-    if (safezone.enabled && value >= safezone.startValue && value <= safezone.endValue) {
-        return safezonecolor;
+    if (zonetabledirty) rebuildZoneTable();
+
+    // Last segment starting at or below the value
+    std::vector<ZoneSegment>::const_iterator it = std::upper_bound(zonetable.begin(), zonetable.end(), value,
+            [](float v, const ZoneSegment& segment) { return v < segment.startValue; });
+    if (it != zonetable.begin()) {
+        --it;
+        // On a shared boundary the zone with higher precedence wins
+        if (value == it->startValue && it != zonetable.begin()) {
+            std::vector<ZoneSegment>::const_iterator before = it - 1;
+            if (before->endValue == value && before->priority > it->priority) return before->color;
+        }
+        if (value <= it->endValue) return it->color;
     }
     return gColor(0, 0, 0, 0);  // Transparent/no zone color
 }
 
-std::vector<float> gipGauge::generateTickValues(bool majorTicks) {
-    std::vector<float> values;
-    
-    if (majorTicks) {
-        for (int i = 0; i <= majortickcount; i++) {
-            float value = minvalue + (maxvalue - minvalue) * i / majortickcount;
-            values.push_back(value);
+void gipGauge::rebuildZoneTable() {
+    zonetable.clear();
+
+    // Lowest precedence first, the last zone covering an interval wins
+    std::vector<const ValueZone*> ordered;
+    for (const ValueZone& zone : customzones) {
+        if (zone.enabled) ordered.push_back(&zone);
+    }
+    if (safezone.enabled) ordered.push_back(&safezone);
+    if (warningzone.enabled) ordered.push_back(&warningzone);
+    if (dangerzone.enabled) ordered.push_back(&dangerzone);
+
+    std::vector<float> bounds;
+    bounds.reserve(ordered.size() * 2);
+    for (const ValueZone* zone : ordered) {
+        bounds.push_back(zone->startValue);
+        bounds.push_back(zone->endValue);
+    }
+    std::sort(bounds.begin(), bounds.end());
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+    int previous = -1;
+    for (size_t i = 0; i + 1 < bounds.size(); i++) {
+        float middle = (bounds[i] + bounds[i + 1]) * 0.5f;
+        int winner = -1;
+        for (size_t j = 0; j < ordered.size(); j++) {
+            float low = std::min(ordered[j]->startValue, ordered[j]->endValue);
+            float high = std::max(ordered[j]->startValue, ordered[j]->endValue);
+            if (middle >= low && middle <= high) winner = j;
         }
-    } else {
-        float majorInterval = (maxvalue - minvalue) / majortickcount;
-        float minorInterval = majorInterval / (minortickcount + 1);
-        
-        for (int i = 0; i < majortickcount; i++) {
-            float majorValue = minvalue + majorInterval * i;
-            for (int j = 1; j <= minortickcount; j++) {
-                float minorValue = majorValue + minorInterval * j;
-                if (minorValue < maxvalue) {
-                    values.push_back(minorValue);
-                }
-            }
+
+        if (winner < 0) {
+            previous = -1;
+        } else if (winner == previous) {
+            zonetable.back().endValue = bounds[i + 1];
+        } else {
+            zonetable.push_back({bounds[i], bounds[i + 1], ordered[winner]->color, winner});
+            previous = winner;
         }
     }
-    
-    return values;
+
+    zonetabledirty = false;
 }
 
-std::string gipGauge::formatValue(float value) {
-    std::stringstream ss;
-    ss << std::fixed << std::setprecision(1) << value;
-    return ss.str();
+int gipGauge::formatValue(float value, char* buffer, int size) const {
+    int length = std::snprintf(buffer, size, "%.*f", valueprecision, value);
+    return std::max(0, std::min(length, size - 1));
 }
 
 // Value management
 void gipGauge::setValue(float value) {
-    targetvalue = std::max(minvalue, std::min(maxvalue, value));
+    // Clamped on consumption, the range belongs to the render thread. Alarms
+    // need every value, the slot only keeps the latest.
+    if (!alarmingestion.enabled.load(std::memory_order_acquire) ||
+        !alarmingestion.ring.push({value, std::chrono::steady_clock::now()})) {
+        valueslot.publish(value);
+    }
+    wakeScheduler();
+}
+
+void gipGauge::setSampleBufferSize(int size) {
+    samplering.allocate(std::max(0, size));
+}
+
+int gipGauge::getSampleBufferSize() const {
+    return samplering.getCapacity();
+}
+
+bool gipGauge::pushSample(float value) {
+    if (!samplering.push(value)) return false;
+    wakeScheduler();
+    return true;
+}
+
+// Value history
+void gipGauge::setHistorySize(int capacity, int levels) {
+    history.allocate(std::max(0, capacity), levels);
+}
+
+const gipGaugeHistory& gipGauge::getHistory() const {
+    return history;
+}
+
+void gipGauge::clearHistory() {
+    history.clear();
+}
+
+void gipGauge::setShowSparkline(bool show) {
+    showsparkline = show;
+}
+
+bool gipGauge::getShowSparkline() const {
+    return showsparkline;
+}
+
+void gipGauge::setSparklineColor(const gColor& color) {
+    sparklinecolor = color;
+}
+
+gColor gipGauge::getSparklineColor() const {
+    return sparklinecolor;
+}
+
+void gipGauge::setSparklineSpan(int64_t samples) {
+    sparklinespan = std::max<int64_t>(0, samples);
+}
+
+int64_t gipGauge::getSparklineSpan() const {
+    return sparklinespan;
+}
+
+// Streaming statistics
+void gipGauge::setStatsEnabled(bool enabled) {
+    if (enabled && !statsenabled) stats.reset();
+    statsenabled = enabled;
+}
+
+bool gipGauge::isStatsEnabled() const {
+    return statsenabled;
+}
+
+void gipGauge::setStatsWindow(int samples) {
+    stats.setWindow(samples);
+}
+
+void gipGauge::setStatsQuantile(float quantile) {
+    stats.setQuantile(quantile);
+}
+
+void gipGauge::setPeakDecay(float decay) {
+    stats.setPeakDecay(decay);
+}
+
+const gipGaugeStats& gipGauge::getStats() const {
+    return stats;
+}
+
+void gipGauge::resetStats() {
+    stats.reset();
+}
+
+void gipGauge::setShowPeakMarkers(bool show) {
+    showpeakmarkers = show;
+    if (show) setStatsEnabled(true);
+}
+
+bool gipGauge::getShowPeakMarkers() const {
+    return showpeakmarkers;
+}
+
+void gipGauge::setPeakMarkerColor(const gColor& color) {
+    peakmarkercolor = color;
+}
+
+void gipGauge::setValleyMarkerColor(const gColor& color) {
+    valleymarkercolor = color;
+}
+
+gColor gipGauge::getPeakMarkerColor() const {
+    return peakmarkercolor;
+}
+
+gColor gipGauge::getValleyMarkerColor() const {
+    return valleymarkercolor;
+}
+
+void gipGauge::setValues(const float* samples, size_t n) {
+    if (samples == nullptr || n == 0) return;
+    gipGaugeBlockSummary block;
+    block.reduce(samples, n);
+
+    // A full ring keeps folding blocks into the pending summary, so nothing
+    // is dropped, only delivered a frame later
+    if (blockpending.count > 0) {
+        blockpending.merge(block);
+        block = blockpending;
+    }
+    if (blockring.push(block)) blockpending.reset();
+    else blockpending = block;
+    wakeScheduler();
+}
+
+void gipGauge::bindTelemetry(gipGaugeTelemetry* newtelemetry, int slot) {
+    telemetry = newtelemetry;
+    telemetryslot = newtelemetry ? slot : -1;
+    telemetrysequence = 0;
+    telemetrystatus = gipGaugeTelemetry::STATUS_ABSENT;
+    wakeScheduler();
+}
+
+gipGaugeTelemetry* gipGauge::getTelemetry() const {
+    return telemetry;
+}
+
+int gipGauge::getTelemetrySlot() const {
+    return telemetryslot;
+}
+
+gipGaugeTelemetry::Status gipGauge::getTelemetryStatus() const {
+    return telemetrystatus;
+}
+
+void gipGauge::setReductionPolicy(ReductionPolicy policy) {
+    reductionpolicy = policy;
+}
+
+gipGauge::ReductionPolicy gipGauge::getReductionPolicy() const {
+    return reductionpolicy;
+}
+
+float gipGauge::getBlockMin() const {
+    return lastblock.min;
+}
+
+float gipGauge::getBlockMax() const {
+    return lastblock.max;
 }
 
 float gipGauge::getValue() const {
@@ -516,12 +1202,14 @@ void gipGauge::setMinValue(float minValue) {
     minvalue = minValue;
     if (targetvalue < minvalue) targetvalue = minvalue;
     if (currentvalue < minvalue) currentvalue = minvalue;
+    invalidateGeometry();
 }
 
 void gipGauge::setMaxValue(float maxValue) {
     maxvalue = maxValue;
     if (targetvalue > maxvalue) targetvalue = maxvalue;
     if (currentvalue > maxvalue) currentvalue = maxvalue;
+    invalidateGeometry();
 }
 
 float gipGauge::getMinValue() const {
@@ -537,10 +1225,12 @@ void gipGauge::setValueRange(float minValue, float maxValue) {
     maxvalue = maxValue;
     targetvalue = std::max(minvalue, std::min(maxvalue, targetvalue));
     currentvalue = std::max(minvalue, std::min(maxvalue, currentvalue));
+    invalidateGeometry();
 }
 
 // Visual customization
 void gipGauge::setGaugeType(GaugeType type) {
+    if (type != gaugetype) invalidateGeometry();
     gaugetype = type;
 }
 
@@ -566,15 +1256,27 @@ std::string gipGauge::getTitle() const {
 
 void gipGauge::setUnit(const std::string& unitText) {
     unit = unitText;
+    valuetextdirty = true;
 }
 
 std::string gipGauge::getUnit() const {
     return unit;
 }
 
+void gipGauge::setValuePrecision(int precision) {
+    valueprecision = std::max(0, std::min(6, precision));
+    valuetextdirty = true;
+    invalidateGeometry();
+}
+
+int gipGauge::getValuePrecision() const {
+    return valueprecision;
+}
+
 // Color setters
 void gipGauge::setBackgroundColor(const gColor& color) {
     backgroundcolor = color;
+    invalidateStaticLayer();
 }
 
 void gipGauge::setNeedleColor(const gColor& color) {
@@ -583,6 +1285,7 @@ void gipGauge::setNeedleColor(const gColor& color) {
 
 void gipGauge::setTickColor(const gColor& color) {
     tickcolor = color;
+    invalidateStaticLayer();
 }
 
 void gipGauge::setValueTextColor(const gColor& color) {
@@ -596,16 +1299,19 @@ void gipGauge::setTitleColor(const gColor& color) {
 void gipGauge::setDangerZoneColor(const gColor& color) {
     dangerzonecolor = color;
     dangerzone.color = color;
+    invalidateZones();
 }
 
 void gipGauge::setWarningZoneColor(const gColor& color) {
     warningzonecolor = color;
     warningzone.color = color;
+    invalidateZones();
 }
 
 void gipGauge::setSafeZoneColor(const gColor& color) {
     safezonecolor = color;
     safezone.color = color;
+    invalidateZones();
 }
 
 // Color getters
@@ -634,24 +1340,117 @@ void gipGauge::setDangerZone(float startValue, float endValue) {
     dangerzone.startValue = startValue;
     dangerzone.endValue = endValue;
     dangerzone.enabled = true;
+    invalidateZones();
 }
 
 void gipGauge::setWarningZone(float startValue, float endValue) {
     warningzone.startValue = startValue;
     warningzone.endValue = endValue;
     warningzone.enabled = true;
+    invalidateZones();
 }
 
 void gipGauge::setSafeZone(float startValue, float endValue) {
     safezone.startValue = startValue;
     safezone.endValue = endValue;
     safezone.enabled = true;
+    invalidateZones();
 }
 
 void gipGauge::clearZones() {
     dangerzone.enabled = false;
     warningzone.enabled = false;
     safezone.enabled = false;
+    customzones.clear();
+    countZoneAlarms();
+    invalidateZones();
+}
+
+int gipGauge::addZone(float startValue, float endValue, const gColor& color) {
+    customzones.push_back({startValue, endValue, color, true, ZoneAlarm(), nextzoneid++});
+    invalidateZones();
+    return customzones.size() - 1;
+}
+
+void gipGauge::setZone(int index, float startValue, float endValue) {
+    if (index < 0 || index >= static_cast<int>(customzones.size())) return;
+    customzones[index].startValue = startValue;
+    customzones[index].endValue = endValue;
+    invalidateZones();
+}
+
+void gipGauge::setZoneColor(int index, const gColor& color) {
+    if (index < 0 || index >= static_cast<int>(customzones.size())) return;
+    customzones[index].color = color;
+    invalidateZones();
+}
+
+void gipGauge::removeZone(int index) {
+    if (index < 0 || index >= static_cast<int>(customzones.size())) return;
+    customzones.erase(customzones.begin() + index);
+    countZoneAlarms();
+    invalidateZones();
+}
+
+int gipGauge::getZoneNum() const {
+    return customzones.size();
+}
+
+void gipGauge::setZoneAlarm(int zone, bool enabled, float hysteresis, float dwell) {
+    ValueZone* target = findZone(zone);
+    if (target == nullptr) return;
+    if (enabled && !target->alarm.enabled) {
+        // Starts outside, a value already in the zone raises an enter event
+        target->alarm.inside = false;
+        target->alarm.pending = false;
+    }
+    target->alarm.enabled = enabled;
+    target->alarm.hysteresis = std::max(0.0f, hysteresis);
+    target->alarm.dwell = std::max(0.0f, dwell);
+    countZoneAlarms();
+    // The current value is checked at the next consume pass, not only the
+    // next sample, so a sleeping gauge is woken for it
+    if (enabled) zonealarmpending = true;
+    wakeScheduler();
+}
+
+bool gipGauge::isZoneAlarmEnabled(int zone) const {
+    const ValueZone* target = findZone(zone);
+    return target && target->alarm.enabled;
+}
+
+bool gipGauge::isInZone(int zone) const {
+    const ValueZone* target = findZone(zone);
+    return target && target->alarm.enabled && target->alarm.inside;
+}
+
+int gipGauge::findZoneIndex(int zoneId) const {
+    for (size_t i = 0; i < customzones.size(); i++) {
+        if (customzones[i].id == zoneId) return i;
+    }
+    return -1;
+}
+
+void gipGauge::setAlarmSink(gipGaugeAlarmSink* sink) {
+    alarmsink = sink;
+}
+
+gipGaugeAlarmSink* gipGauge::getAlarmSink() const {
+    return alarmsink;
+}
+
+void gipGauge::pollZoneEvents(std::vector<gipGaugeZoneEvent>& out) {
+    out.clear();
+    out.swap(zoneevents);
+}
+
+void gipGauge::setRetainedMode(bool enabled) {
+    retainedmode = enabled;
+    invalidateStaticLayer();
+}
+
+bool gipGauge::isRetainedMode() const {
+    return retainedmode;
 }
 
 // Animation
@@ -671,13 +1470,53 @@ float gipGauge::getAnimationSpeed() const {
     return animationspeed;
 }
 
+void gipGauge::setAnimator(gipGaugeAnimator* animator) {
+    if (animator == animatorbinding.animator) return;
+    if (animator) setScheduler(nullptr);
+    if (animatorbinding.animator) animatorbinding.animator->removeSlot(animatorbinding.slot);
+    detachAnimator();
+    if (animator) {
+        animatorbinding.animator = animator;
+        animatorbinding.slot = animator->addSlot(this, currentvalue);
+        animatorbinding.target = targetvalue;
+        animatorbinding.speed = animationspeed;
+        animator->setTarget(animatorbinding.slot, targetvalue);
+        animator->setSpeed(animatorbinding.slot, animationspeed);
+    }
+}
+
+gipGaugeAnimator* gipGauge::getAnimator() const {
+    return animatorbinding.animator;
+}
+
+void gipGauge::setScheduler(gipGaugeScheduler* scheduler) {
+    gipGaugeScheduler* previous = schedulerbinding.scheduler.load(std::memory_order_relaxed);
+    if (scheduler == previous) return;
+    if (previous) {
+        schedulerbinding.scheduler = nullptr;
+        previous->detach(this);
+        detachScheduler();
+    }
+    if (scheduler) {
+        setAnimator(nullptr);
+        schedulerbinding.scheduler = scheduler;
+        scheduler->attach(this);
+    }
+}
+
+gipGaugeScheduler* gipGauge::getScheduler() const {
+    return schedulerbinding.scheduler.load(std::memory_order_relaxed);
+}
+
 // Tick management
 void gipGauge::setMajorTickCount(int count) {
     majortickcount = std::max(2, count);
+    invalidateGeometry();
 }
 
 void gipGauge::setMinorTickCount(int count) {
     minortickcount = std::max(0, count);
+    invalidateGeometry();
 }
 
 int gipGauge::getMajorTickCount() const {
@@ -690,12 +1529,35 @@ int gipGauge::getMinorTickCount() const {
 
 void gipGauge::setShowTickLabels(bool show) {
     showticklabels = show;
+    invalidateStaticLayer();
 }
 
 bool gipGauge::getShowTickLabels() const {
     return showticklabels;
 }
 
+// Level of detail
+void gipGauge::setLodEnabled(bool enabled) {
+    lod.enabled = enabled;
+    invalidateGeometry();
+}
+
+bool gipGauge::isLodEnabled() const {
+    return lod.enabled;
+}
+
+void gipGauge::setLodSettings(const LodSettings& settings) {
+    lod = settings;
+    lod.segmentLength = std::max(1.0f, lod.segmentLength);
+    lod.minSegments = std::max(3, lod.minSegments);
+    lod.maxSegments = std::max(lod.minSegments, lod.maxSegments);
+    invalidateGeometry();
+}
+
+const gipGauge::LodSettings& gipGauge::getLodSettings() const {
+    return lod;
+}
+
 // Display options
 void gipGauge::setShowValue(bool show) {
     showvalue = show;
@@ -736,4 +1598,168 @@ float gipGauge::getNeedleLength() const {
 
 float gipGauge::getNeedleWidth() const {
     return needlewidth;
-}
\ No newline at end of file
+}
+// Configuration records
+void gipGauge::getConfig(Config& config) const {
+    std::memset(&config, 0, sizeof(Config));
+    config.type = gaugetype;
+    config.style = gaugestyle;
+    config.minValue = minvalue;
+    config.maxValue = maxvalue;
+    config.valuePrecision = valueprecision;
+    config.majorTicks = majortickcount;
+    config.minorTicks = minortickcount;
+    copyColor(config.backgroundColor, backgroundcolor);
+    copyColor(config.needleColor, needlecolor);
+    copyColor(config.tickColor, tickcolor);
+    copyColor(config.valueTextColor, valuetextcolor);
+    copyColor(config.titleColor, titlecolor);
+    copyColor(config.dangerZoneColor, dangerzone.color);
+    copyColor(config.warningZoneColor, warningzone.color);
+    copyColor(config.safeZoneColor, safezone.color);
+    config.dangerZone[0] = dangerzone.startValue;
+    config.dangerZone[1] = dangerzone.endValue;
+    config.warningZone[0] = warningzone.startValue;
+    config.warningZone[1] = warningzone.endValue;
+    config.safeZone[0] = safezone.startValue;
+    config.safeZone[1] = safezone.endValue;
+    config.dangerZoneEnabled = dangerzone.enabled;
+    config.warningZoneEnabled = warningzone.enabled;
+    config.safeZoneEnabled = safezone.enabled;
+    config.showTickLabels = showticklabels;
+    config.showValue = showvalue;
+    config.showTitle = showtitle;
+    config.showNeedle = showneedle;
+    config.animationEnabled = animationenabled;
+    config.retainedMode = retainedmode;
+    config.lodEnabled = lod.enabled;
+    config.showSparkline = showsparkline;
+    config.showPeakMarkers = showpeakmarkers;
+    config.animationSpeed = animationspeed;
+    config.needleLength = needlelength;
+    config.needleWidth = needlewidth;
+    copyText(config.title, sizeof(config.title), title);
+    copyText(config.unit, sizeof(config.unit), unit);
+}
+
+void gipGauge::applyConfig(const Config& config) {
+    gaugetype = static_cast<GaugeType>(std::max(0, std::min(3, static_cast<int>(config.type))));
+    gaugestyle = static_cast<GaugeStyle>(std::max(0, std::min(3, static_cast<int>(config.style))));
+    minvalue = config.minValue;
+    maxvalue = config.maxValue;
+    targetvalue = std::max(minvalue, std::min(maxvalue, targetvalue));
+    currentvalue = std::max(minvalue, std::min(maxvalue, currentvalue));
+    valueprecision = std::max(0, std::min(6, static_cast<int>(config.valuePrecision)));
+    majortickcount = std::max(2, static_cast<int>(config.majorTicks));
+    minortickcount = std::max(0, static_cast<int>(config.minorTicks));
+    backgroundcolor = toColor(config.backgroundColor);
+    needlecolor = toColor(config.needleColor);
+    tickcolor = toColor(config.tickColor);
+    valuetextcolor = toColor(config.valueTextColor);
+    titlecolor = toColor(config.titleColor);
+    dangerzonecolor = toColor(config.dangerZoneColor);
+    warningzonecolor = toColor(config.warningZoneColor);
+    safezonecolor = toColor(config.safeZoneColor);
+    dangerzone = {config.dangerZone[0], config.dangerZone[1], dangerzonecolor, config.dangerZoneEnabled != 0, dangerzone.alarm, ZONE_DANGER};
+    warningzone = {config.warningZone[0], config.warningZone[1], warningzonecolor, config.warningZoneEnabled != 0, warningzone.alarm, ZONE_WARNING};
+    safezone = {config.safeZone[0], config.safeZone[1], safezonecolor, config.safeZoneEnabled != 0, safezone.alarm, ZONE_SAFE};
+    showticklabels = config.showTickLabels != 0;
+    showvalue = config.showValue != 0;
+    showtitle = config.showTitle != 0;
+    showneedle = config.showNeedle != 0;
+    animationenabled = config.animationEnabled != 0;
+    retainedmode = config.retainedMode != 0;
+    lod.enabled = config.lodEnabled != 0;
+    showsparkline = config.showSparkline != 0;
+    showpeakmarkers = config.showPeakMarkers != 0;
+    if (showpeakmarkers) setStatsEnabled(true);
+    animationspeed = config.animationSpeed;
+    needlelength = std::max(0.1f, std::min(1.0f, config.needleLength));
+    needlewidth = std::max(1.0f, config.needleWidth);
+    title.assign(config.title, strnlen(config.title, sizeof(config.title)));
+    unit.assign(config.unit, strnlen(config.unit, sizeof(config.unit)));
+
+    valuetextdirty = true;
+    invalidateGeometry();
+    invalidateZones();
+}
+
+void gipGauge::getZoneConfigs(std::vector<ZoneConfig>& zones) const {
+    zones.resize(customzones.size());
+    for (size_t i = 0; i < customzones.size(); i++) {
+        zones[i].startValue = customzones[i].startValue;
+        zones[i].endValue = customzones[i].endValue;
+        copyColor(zones[i].color, customzones[i].color);
+    }
+}
+
+void gipGauge::setZoneConfigs(const ZoneConfig* zones, int count) {
+    size_t previous = customzones.size();
+    customzones.resize(std::max(0, count));
+    // Alarms and ids stay with their zone index, a reload keeps their state
+    for (size_t i = 0; i < customzones.size(); i++) {
+        int id = i < previous ? customzones[i].id : nextzoneid++;
+        customzones[i] = {zones[i].startValue, zones[i].endValue, toColor(zones[i].color), true, customzones[i].alarm, id};
+    }
+    countZoneAlarms();
+    invalidateZones();
+}
+
+// Snapshots
+void gipGauge::snapshot(std::vector<uint8_t>& out) const {
+    Config config;
+    getConfig(config);
+    std::vector<ZoneConfig> zones;
+    getZoneConfigs(zones);
+
+    gipGaugeBinary::append(out, snapshotmagic);
+    gipGaugeBinary::append(out, snapshotversion);
+    gipGaugeBinary::append(out, config);
+    gipGaugeBinary::appendVector(out, zones);
+    gipGaugeBinary::append(out, currentvalue);
+    gipGaugeBinary::append(out, targetvalue);
+    history.save(out);
+    gipGaugeBinary::append(out, static_cast<uint8_t>(statsenabled));
+    stats.save(out);
+}
+
+bool gipGauge::restore(const uint8_t* data, size_t size, bool restoreConfig) {
+    // The whole snapshot is parsed before anything is applied, so a truncated
+    // or corrupt one leaves the gauge untouched
+    const uint8_t* cursor = data;
+    const uint8_t* end = data + size;
+    uint32_t magic, version;
+    Config config;
+    std::vector<ZoneConfig> zones;
+    float current, target;
+    gipGaugeHistory loadedhistory;
+    uint8_t enabled;
+    gipGaugeStats loadedstats;
+    if (!gipGaugeBinary::read(cursor, end, magic) || magic != snapshotmagic ||
+        !gipGaugeBinary::read(cursor, end, version) || version != snapshotversion ||
+        !gipGaugeBinary::read(cursor, end, config) ||
+        !gipGaugeBinary::readVector(cursor, end, zones) ||
+        !gipGaugeBinary::read(cursor, end, current) ||
+        !gipGaugeBinary::read(cursor, end, target) ||
+        !loadedhistory.load(cursor, end) ||
+        !gipGaugeBinary::read(cursor, end, enabled) ||
+        !loadedstats.load(cursor, end)) {
+        return false;
+    }
+
+    if (restoreConfig) {
+        applyConfig(config);
+        setZoneConfigs(zones.data(), zones.size());
+    }
+    // Values are clamped to whichever range is now in effect
+    currentvalue = std::max(minvalue, std::min(maxvalue, current));
+    targetvalue = std::max(minvalue, std::min(maxvalue, target));
+    if (animatorbinding.animator) animatorbinding.animator->setCurrent(animatorbinding.slot, currentvalue);
+    wakeScheduler();
+    valuetextdirty = true;
+
+    history = loadedhistory;
+    statsenabled = enabled != 0;
+    stats = loadedstats;
+    return true;
+}
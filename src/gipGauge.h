@@ -11,8 +11,24 @@
 
 #include "gBasePlugin.h"
 #include "gColor.h"
+#include "gipGaugeSampleRing.h"
+#include "gipGaugeDrawList.h"
+#include "gipGaugeTickKernel.h"
+#include "gipGaugeHistory.h"
+#include "gipGaugeStats.h"
+#include "gipGaugeBlockSummary.h"
+#include "gipGaugeTelemetry.h"
+#include "gipGaugeCounters.h"
+#include "gipGaugeAlarms.h"
 #include <vector>
 #include <string>
+#include <chrono>
+#include <atomic>
+
+class gipGaugeBackend;
+class gipGaugeBatch;
+class gipGaugeAnimator;
+class gipGaugeScheduler;
 
 class gipGauge : public gBasePlugin {
 public:
@@ -24,6 +40,15 @@ public:
         GAUGE_LINEAR_VERTICAL
     };
 
+    // How a block of samples from setValues() becomes the displayed value
+    enum ReductionPolicy {
+        REDUCE_LAST = 0,
+        REDUCE_MEAN,
+        REDUCE_MAX,
+        REDUCE_MIN,
+        REDUCE_RMS
+    };
+
     // Gauge style
     enum GaugeStyle {
         STYLE_MODERN = 0,
@@ -39,7 +64,32 @@ public:
     void draw(int x, int y, int w, int h);
     void update();
 
+    // Builds the cached tick geometry, labels, zone table and retained layer
+    // for a draw rect without drawing. Only this gauge is touched, so several
+    // gauges can be prepared on worker threads while none of them is drawn.
+    void prepare(int x, int y, int w, int h);
+    // True if the next draw() in this rect would rebuild cached geometry
+    bool needsPrepare(int x, int y, int w, int h) const;
+
+    // Performance counters, collected only when the plugin is built with
+    // GIPGAUGE_ENABLE_STATS. getFrameCounters() covers the last draw() and
+    // the updates since the draw before it. Without the flag both return
+    // zeroed counters.
+    const gipGaugeCounters& getCounters() const;
+    const gipGaugeCounters& getFrameCounters() const;
+    void resetCounters();
+    // Draws the per-frame averages over the top left corner of the gauge,
+    // ignored without the flag
+    void setShowCountersOverlay(bool show);
+    bool getShowCountersOverlay() const;
+
+    // Drawing backend, nullptr selects the global renderer
+    void setBackend(gipGaugeBackend* backend);
+    gipGaugeBackend* getBackend() const;
+
     // Value management
+    // setValue() is lock-free and may be called from any thread, the newest
+    // value is picked up by the next update() on the render thread
     void setValue(float value);
     float getValue() const;
     void setMinValue(float minValue);
@@ -48,6 +98,62 @@ public:
     float getMaxValue() const;
     void setValueRange(float minValue, float maxValue);
 
+    // Sample streams from a single producer thread, drained in order by update()
+    void setSampleBufferSize(int size);
+    int getSampleBufferSize() const;
+    bool pushSample(float value);
+
+    // Bulk ingestion from a single producer thread. Each block is reduced in
+    // one vectorized pass, all blocks since the last update() are merged and
+    // the policy picks the displayed value. Extremes are kept for the peak
+    // markers, so no spike between frames goes unseen.
+    void setValues(const float* samples, size_t n);
+    void setReductionPolicy(ReductionPolicy policy);
+    ReductionPolicy getReductionPolicy() const;
+    // Extremes of the samples merged by the last update() that received a block
+    float getBlockMin() const;
+    float getBlockMax() const;
+
+    // Reads the value from a memory-mapped telemetry slot in every update(),
+    // new writes are consumed like setValue(). The segment must outlive the
+    // binding, nullptr unbinds. While the writer is stale or absent the gauge
+    // keeps its last value.
+    void bindTelemetry(gipGaugeTelemetry* telemetry, int slot);
+    gipGaugeTelemetry* getTelemetry() const;
+    int getTelemetrySlot() const;
+    gipGaugeTelemetry::Status getTelemetryStatus() const;
+
+    // Value history of every consumed sample, with an optional sparkline.
+    // Memory is fixed at capacity floats per level, see gipGaugeHistory.
+    // A capacity of 0 disables the history.
+    void setHistorySize(int capacity, int levels = 4);
+    const gipGaugeHistory& getHistory() const;
+    void clearHistory();
+    void setShowSparkline(bool show);
+    bool getShowSparkline() const;
+    void setSparklineColor(const gColor& color);
+    gColor getSparklineColor() const;
+    // Newest samples shown by the sparkline, 0 shows all available history
+    void setSparklineSpan(int64_t samples);
+    int64_t getSparklineSpan() const;
+
+    // Rolling min/max, mean/variance, quantile and peak hold of every consumed
+    // sample, updated in O(1) per sample, see gipGaugeStats
+    void setStatsEnabled(bool enabled);
+    bool isStatsEnabled() const;
+    void setStatsWindow(int samples);
+    void setStatsQuantile(float quantile);
+    void setPeakDecay(float decay);
+    const gipGaugeStats& getStats() const;
+    void resetStats();
+    // Peak and valley hold markers on the arc or bar, enables the statistics
+    void setShowPeakMarkers(bool show);
+    bool getShowPeakMarkers() const;
+    void setPeakMarkerColor(const gColor& color);
+    void setValleyMarkerColor(const gColor& color);
+    gColor getPeakMarkerColor() const;
+    gColor getValleyMarkerColor() const;
+
     // Visual customization
     void setGaugeType(GaugeType type);
     GaugeType getGaugeType() const;
@@ -58,6 +164,9 @@ public:
     std::string getTitle() const;
     void setUnit(const std::string& unit);
     std::string getUnit() const;
+    // Decimal places of the value readout and tick labels, 0 to 6
+    void setValuePrecision(int precision);
+    int getValuePrecision() const;
 
     // Colors
     void setBackgroundColor(const gColor& color);
@@ -79,13 +188,65 @@ public:
     void setDangerZone(float startValue, float endValue);
     void setWarningZone(float startValue, float endValue);
     void setSafeZone(float startValue, float endValue);
+    // Any number of additional bands. Where zones overlap, later zones win,
+    // and the safe, warning and danger zones win over all of them.
+    int addZone(float startValue, float endValue, const gColor& color);
+    void setZone(int index, float startValue, float endValue);
+    void setZoneColor(int index, const gColor& color);
+    void removeZone(int index);
+    int getZoneNum() const;
     void clearZones();
 
+    // Zone alarms raise enter and exit events for the ingested values rather
+    // than the animated one. While an alarm is enabled setValue() queues
+    // every value with the time it was set, from any producer thread, so a
+    // spike between two frames is still raised and dwell is measured in
+    // ingestion time. If the queue of a gauge overflows, values fall back to
+    // the latest-value slot. Sample buffer and telemetry samples, and the min,
+    // max and reduced value of each frame's blocks, are checked too, at the
+    // time of the consume pass. Events are raised on the thread that consumes,
+    // in update() or the scheduler. Zones are identified by their custom zone
+    // index or one of these:
+    enum {
+        ZONE_DANGER = -1,
+        ZONE_WARNING = -2,
+        ZONE_SAFE = -3
+    };
+    // A zone is entered at its bounds and left only once the value is more
+    // than hysteresis beyond them. A crossing is raised after the new state
+    // has held for dwell seconds, shorter excursions raise nothing.
+    void setZoneAlarm(int zone, bool enabled, float hysteresis = 0.0f, float dwell = 0.0f);
+    bool isZoneAlarmEnabled(int zone) const;
+    // Debounced state of an alarmed zone
+    bool isInZone(int zone) const;
+    // Events name a custom zone by a stable id, the index it was added at.
+    // Removing a zone does not change the ids of the others; this gives the
+    // current index of an id, or -1 once its zone was removed.
+    int findZoneIndex(int zoneId) const;
+    // Events go to the sink, shared by a dashboard, or queue in the gauge
+    void setAlarmSink(gipGaugeAlarmSink* sink);
+    gipGaugeAlarmSink* getAlarmSink() const;
+    // Moves the events queued in the gauge into out, replacing its contents
+    void pollZoneEvents(std::vector<gipGaugeZoneEvent>& out);
+
+    // Retained mode records background, zones and ticks once and replays them,
+    // only the needle, bar and text are regenerated each frame
+    void setRetainedMode(bool enabled);
+    bool isRetainedMode() const;
+
     // Animation
     void setAnimationEnabled(bool enabled);
     bool isAnimationEnabled() const;
     void setAnimationSpeed(float speed);
     float getAnimationSpeed() const;
+    // Hands the animation over to a shared batched animator, nullptr detaches
+    void setAnimator(gipGaugeAnimator* animator);
+    gipGaugeAnimator* getAnimator() const;
+    // Hands ingestion and animation over to an active-set scheduler, which
+    // only steps the gauge while it moves. Replaces an animator, nullptr
+    // detaches. Attach and detach while no other thread feeds the gauge.
+    void setScheduler(gipGaugeScheduler* scheduler);
+    gipGaugeScheduler* getScheduler() const;
 
     // Tick marks
     void setMajorTickCount(int count);
@@ -103,24 +264,145 @@ public:
     bool getShowTitle() const;
     bool getShowNeedle() const;
 
+    // Level of detail. Arc segments follow the on-screen arc length, and minor
+    // ticks, tick labels and the title of arc gauges are dropped below the
+    // given radii in pixels. Overlapping tick labels are culled.
+    struct LodSettings {
+        bool enabled;
+        float segmentLength;
+        int minSegments;
+        int maxSegments;
+        float minorTickMinRadius;
+        float tickLabelMinRadius;
+        float titleMinRadius;
+        bool cullOverlappingLabels;
+    };
+    void setLodEnabled(bool enabled);
+    bool isLodEnabled() const;
+    void setLodSettings(const LodSettings& settings);
+    const LodSettings& getLodSettings() const;
+
     // Size and positioning
     void setNeedleLength(float length);
     void setNeedleWidth(float width);
     float getNeedleLength() const;
     float getNeedleWidth() const;
 
+    // Plain configuration record, trivially copyable so dashboards can store
+    // and apply it in bulk. Longer titles and units are cut to fit.
+    struct Config {
+        int32_t type;
+        int32_t style;
+        float minValue, maxValue;
+        int32_t valuePrecision;
+        int32_t majorTicks, minorTicks;
+        float backgroundColor[4];
+        float needleColor[4];
+        float tickColor[4];
+        float valueTextColor[4];
+        float titleColor[4];
+        float dangerZoneColor[4];
+        float warningZoneColor[4];
+        float safeZoneColor[4];
+        float dangerZone[2];
+        float warningZone[2];
+        float safeZone[2];
+        uint8_t dangerZoneEnabled, warningZoneEnabled, safeZoneEnabled;
+        uint8_t showTickLabels, showValue, showTitle, showNeedle;
+        uint8_t animationEnabled, retainedMode, lodEnabled;
+        uint8_t showSparkline, showPeakMarkers;
+        float animationSpeed, needleLength, needleWidth;
+        char title[48];
+        char unit[16];
+    };
+    struct ZoneConfig {
+        float startValue, endValue;
+        float color[4];
+    };
+    void getConfig(Config& config) const;
+    // Sets everything at once with a single invalidation, values are kept
+    void applyConfig(const Config& config);
+    void getZoneConfigs(std::vector<ZoneConfig>& zones) const;
+    void setZoneConfigs(const ZoneConfig* zones, int count);
+
+    // Binary snapshot of the configuration, custom zones, values, history and
+    // statistics. Restoring with restoreConfig false keeps the current
+    // configuration, so a reloaded dashboard picks up its old runtime state.
+    void snapshot(std::vector<uint8_t>& out) const;
+    bool restore(const uint8_t* data, size_t size, bool restoreConfig = true);
+
 private:
+    friend class gipGaugeBatch;
+    friend class gipGaugeAnimator;
+    friend class gipGaugeScheduler;
+    friend class gipGaugeBenchmark;
+
     // Core properties
     float currentvalue;
     float targetvalue;
     float minvalue;
     float maxvalue;
+
+    // Ingestion from producer threads
+    gipGaugeValueSlot valueslot;
+    gipGaugeSampleRing<float> samplering;
+    gipGaugeSampleRing<gipGaugeBlockSummary> blockring;
+    gipGaugeBlockSummary blockpending;     // Producer side, waits for ring space
+    gipGaugeBlockSummary lastblock;
+    ReductionPolicy reductionpolicy;
+
+    // While zone alarms are enabled, setValue() queues every value with the
+    // time it was set instead of overwriting the slot
+    struct TimedSample {
+        float value;
+        std::chrono::steady_clock::time_point time;
+    };
+    struct AlarmIngestion {
+        static const int CAPACITY = 256;
+        gipGaugeSharedRing<TimedSample> ring;
+        std::atomic<bool> enabled;      // Read by producer threads
+        AlarmIngestion() : enabled(false) {}
+        AlarmIngestion(const AlarmIngestion& other) : ring(other.ring), enabled(other.enabled.load()) {}
+        AlarmIngestion& operator=(const AlarmIngestion& other) {
+            ring = other.ring;
+            enabled = other.enabled.load();
+            return *this;
+        }
+    };
+    AlarmIngestion alarmingestion;
+
+    // Memory-mapped telemetry binding
+    gipGaugeTelemetry* telemetry;
+    int telemetryslot;
+    uint32_t telemetrysequence;
+    gipGaugeTelemetry::Status telemetrystatus;
+
+    // Value history and sparkline columns
+    gipGaugeHistory history;
+    bool showsparkline;
+    gColor sparklinecolor;
+    int64_t sparklinespan;
+    gipGaugeVector<float> sparklinemin;
+    gipGaugeVector<float> sparklinemax;
+
+    // Streaming statistics and peak markers
+    gipGaugeStats stats;
+    bool statsenabled;
+    bool showpeakmarkers;
+    gColor peakmarkercolor;
+    gColor valleymarkercolor;
     
     // Visual properties
     GaugeType gaugetype;
     GaugeStyle gaugestyle;
     std::string title;
     std::string unit;
+    int valueprecision;
+
+    // Value readout, reformatted only when the displayed digits change
+    std::string valuetext;
+    long long valuetextquantized;
+    bool valuetextdirty;
 
     // Colors
     gColor backgroundcolor;
@@ -133,24 +415,82 @@ private:
     gColor safezonecolor;
 
     // Zones
+    struct ZoneAlarm {
+        bool enabled;
+        float hysteresis;
+        float dwell;                // Seconds
+        bool inside;                // Debounced state
+        bool pending;               // The opposite state is waiting out the dwell
+        float pendingvalue;         // Value that started the pending state
+        std::chrono::steady_clock::time_point pendingsince;
+        ZoneAlarm() : enabled(false), hysteresis(0.0f), dwell(0.0f), inside(false), pending(false), pendingvalue(0.0f) {}
+    };
     struct ValueZone {
         float startValue;
         float endValue;
         gColor color;
         bool enabled;
+        ZoneAlarm alarm;
+        int id;                     // Used in its events, stable for custom zones
     };
     ValueZone dangerzone;
     ValueZone warningzone;
     ValueZone safezone;
+    std::vector<ValueZone> customzones;
+    int nextzoneid;
+
+    // Sorted, non-overlapping intervals resolved from all enabled zones
+    struct ZoneSegment {
+        float startValue;
+        float endValue;
+        gColor color;
+        int priority;
+    };
+    std::vector<ZoneSegment> zonetable;
+    bool zonetabledirty;
+
+    // Zone alarms, evaluated only while at least one is enabled
+    int zonealarmnum;
+    bool zonealarmpending;                              // Re-evaluate at the next pass
+    std::chrono::steady_clock::time_point alarmclock;   // Time of the value being evaluated
+    gipGaugeAlarmSink* alarmsink;
+    std::vector<gipGaugeZoneEvent> zoneevents;
 
     // Animation
     bool animationenabled;
     float animationspeed;
+    std::chrono::steady_clock::time_point lastupdatetime;
+    bool hasupdated;
+
+    // Slot in a shared animator, copies of a gauge start detached
+    struct AnimatorBinding {
+        gipGaugeAnimator* animator;
+        int slot;
+        float target, speed;        // Last written to the slot
+        AnimatorBinding() : animator(nullptr), slot(-1), target(0.0f), speed(0.0f) {}
+        AnimatorBinding(const AnimatorBinding&) : AnimatorBinding() {}
+        AnimatorBinding& operator=(const AnimatorBinding&) { return *this; }
+    };
+    AnimatorBinding animatorbinding;
+
+    // Membership in a scheduler, copies of a gauge start detached
+    struct SchedulerBinding {
+        std::atomic<gipGaugeScheduler*> scheduler;  // Read by producer threads
+        int index;                                  // In the scheduler's gauges
+        int activeindex;                            // In its active list, -1 while asleep
+        std::atomic<gipGauge*> wakenext;
+        std::atomic<bool> wakequeued;
+        SchedulerBinding() : scheduler(nullptr), index(-1), activeindex(-1), wakenext(nullptr), wakequeued(false) {}
+        SchedulerBinding(const SchedulerBinding&) : SchedulerBinding() {}
+        SchedulerBinding& operator=(const SchedulerBinding&) { return *this; }
+    };
+    SchedulerBinding schedulerbinding;
     
     // Ticks
     int majortickcount;
     int minortickcount;
     bool showticklabels;
+    LodSettings lod;
 
     // Display flags
     bool showvalue;
@@ -165,30 +505,86 @@ private:
     int gaugex, gaugey, gaugewidth, gaugeheight;
     float centerx, centery, radius;
 
+    // Cached tick geometry, rebuilt only when range, ticks, type or rect change
+    struct TickLabel {
+        float x, y;
+        std::string text;
+        bool visible;
+    };
+    gipGaugeTickArrays majorticks;
+    gipGaugeTickArrays minorticks;
+    gipGaugeVector<TickLabel> ticklabels;
+    gipGaugeVector<float> tickcosines, ticksines;
+    bool geometrydirty;
+
+    // Retained static layer
+    bool retainedmode;
+    bool staticlayerdirty;
+    gipGaugeDrawList staticlayer;
+
+    // Receives all primitives, swapped temporarily by gipGaugeBatch
+    gipGaugeBackend* backend;
+
+#ifdef GIPGAUGE_ENABLE_STATS
+    // Performance counters, absent without the flag
+    gipGaugeCounters counters;
+    gipGaugeCounters framecounters;         // Accumulating until the next draw() ends
+    gipGaugeCounters lastframecounters;
+    gipGaugeCountingBackend countingbackend;
+    bool showcountersoverlay;
+#endif
+
     // Helper methods
     void initializeDefaults();
+    void setDrawRect(int x, int y, int w, int h);
+    void consumeSamples();
+    void recordSample(float value);
+    void recordBlock(const gipGaugeBlockSummary& block);
+    ValueZone* findZone(int zone);
+    const ValueZone* findZone(int zone) const;
+    void countZoneAlarms();
+    void evaluateZoneAlarms(float value);
+    void evaluateZoneAlarm(ValueZone& zone, int id, float value);
+    void raiseZoneEvent(int id, bool entered, float value, std::chrono::steady_clock::time_point time);
     void updateAnimation();
+    // One scheduler step, returns false once the gauge has settled
+    bool step(float deltaTime);
+    void wakeScheduler();
+    void detachScheduler();
+    void detachAnimator();
     float lerp(float start, float end, float t);
+    void invalidateGeometry();
+    void invalidateStaticLayer();
+    void invalidateZones();
+    void rebuildZoneTable();
+    // Rebuilds the tick geometry of the current type, for callers without a policy
+    void rebuildTickGeometry();
+    void cullOverlappingLabels();
+    int getArcSegments(float arcRadius, float sweepAngle, int defaultSegments);
     
-    // Drawing helpers
-    void drawCircularGauge();
-    void drawSemicircleGauge();
-    void drawLinearGaugeHorizontal();
-    void drawLinearGaugeVertical();
-    
-    void drawBackground();
-    void drawTicks();
-    void drawNeedle();
-    void drawValueText();
-    void drawTitle();
-    void drawZones();
+    // Drawing helpers, instantiated per geometry policy (gipGaugeGeometry.h).
+    // draw() selects the policy from the gauge type once per frame.
+    template<typename Policy> void drawGauge();
+    template<typename Policy> void prepareGeometry();
+    template<typename Policy> void recordStaticLayer();
+    template<typename Policy> void rebuildTickGeometry();
+    template<typename Policy> void drawStaticLayer();
+    template<typename Policy> void drawBackground();
+    template<typename Policy> void drawTicks();
+    template<typename Policy> void drawNeedle();
+    template<typename Policy> void drawValueText();
+    template<typename Policy> void drawTitle();
+    template<typename Policy> void drawZones();
+    template<typename Policy> void drawSparkline();
+    template<typename Policy> void drawPeakMarkers();
+    template<typename Policy> void drawMarker(float value);
     
     // Utility functions
+    float valueToRatio(float value);
     float valueToAngle(float value);
     float angleToValue(float angle);
     gColor getZoneColorForValue(float value);
-    std::vector<float> generateTickValues(bool majorTicks);
-    std::string formatValue(float value);
+    int formatValue(float value, char* buffer, int size) const;
 };
 
 #endif /* SRC_GIPGAUGE_H_ */
\ No newline at end of file
@@ -0,0 +1,44 @@
+/*
+ * gipGaugeAlarms.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeAlarms.h"
+
+gipGaugeAlarmSink::gipGaugeAlarmSink() {
+}
+
+gipGaugeAlarmSink::~gipGaugeAlarmSink() {
+}
+
+void gipGaugeAlarmSink::push(const gipGaugeZoneEvent& event) {
+    events.push_back(event);
+}
+
+int gipGaugeAlarmSink::getEventNum() const {
+    return events.size();
+}
+
+const std::vector<gipGaugeZoneEvent>& gipGaugeAlarmSink::getEvents() const {
+    return events;
+}
+
+void gipGaugeAlarmSink::clear() {
+    events.clear();
+}
+
+void gipGaugeAlarmSink::poll(std::vector<gipGaugeZoneEvent>& out) {
+    out.clear();
+    out.swap(events);
+}
+
+void gipGaugeAlarmSink::setCallback(const Callback& newcallback) {
+    callback = newcallback;
+}
+
+void gipGaugeAlarmSink::dispatch() {
+    if (events.empty()) return;
+    if (callback) callback(events.data(), events.size());
+    events.clear();
+}
@@ -0,0 +1,55 @@
+/*
+ * gipGaugeAlarms.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGEALARMS_H_
+#define SRC_GIPGAUGEALARMS_H_
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+class gipGauge;
+
+// Zone enter or exit, raised while a gauge consumes its values
+struct gipGaugeZoneEvent {
+    gipGauge* gauge;
+    int zone;           // Custom zone id, or gipGauge::ZONE_SAFE/WARNING/DANGER
+    bool entered;
+    float value;        // Value that started the crossing
+    std::chrono::steady_clock::time_point time;     // When the crossing completed
+};
+
+// Collects the zone events of many gauges, typically a whole dashboard, so
+// they can be handled once per frame instead of per sample or per gauge.
+// Producer threads only queue values; gauges evaluate them and push events
+// on the thread that consumes them, the render thread or the scheduler's,
+// and the sink is drained on that same thread, so it needs no locking.
+class gipGaugeAlarmSink {
+public:
+    typedef std::function<void(const gipGaugeZoneEvent* events, int count)> Callback;
+
+    gipGaugeAlarmSink();
+    virtual ~gipGaugeAlarmSink();
+
+    void push(const gipGaugeZoneEvent& event);
+    int getEventNum() const;
+    const std::vector<gipGaugeZoneEvent>& getEvents() const;
+    void clear();
+
+    // Moves the queued events into out, replacing its contents. Swapping
+    // keeps both buffers' capacity, so steady-state polling doesn't allocate.
+    void poll(std::vector<gipGaugeZoneEvent>& out);
+
+    // Hands all queued events to the callback in one call, then clears them
+    void setCallback(const Callback& callback);
+    void dispatch();
+
+private:
+    std::vector<gipGaugeZoneEvent> events;
+    Callback callback;
+};
+
+#endif /* SRC_GIPGAUGEALARMS_H_ */
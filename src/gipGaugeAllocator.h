@@ -0,0 +1,50 @@
+/*
+ * gipGaugeAllocator.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGEALLOCATOR_H_
+#define SRC_GIPGAUGEALLOCATOR_H_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#ifdef GIPGAUGE_ENABLE_STATS
+// Adds one to the calling thread's allocation count, see gipGaugeCounters
+void gipGaugeCountBufferAllocation();
+
+// Allocator of the buffers the plugin fills while drawing. With the flag it
+// counts every heap allocation it makes for the performance counters, so
+// only the plugin's own buffers are observed and nothing global is replaced.
+template<typename T>
+class gipGaugeAllocator {
+public:
+    typedef T value_type;
+
+    gipGaugeAllocator() {}
+    template<typename U> gipGaugeAllocator(const gipGaugeAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        gipGaugeCountBufferAllocation();
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* memory, size_t n) {
+        std::allocator<T>().deallocate(memory, n);
+    }
+
+    template<typename U> bool operator==(const gipGaugeAllocator<U>&) const { return true; }
+    template<typename U> bool operator!=(const gipGaugeAllocator<U>&) const { return false; }
+};
+#else
+template<typename T>
+using gipGaugeAllocator = std::allocator<T>;
+#endif
+
+// Frame buffers, a plain std::vector without GIPGAUGE_ENABLE_STATS
+template<typename T>
+using gipGaugeVector = std::vector<T, gipGaugeAllocator<T>>;
+
+#endif /* SRC_GIPGAUGEALLOCATOR_H_ */
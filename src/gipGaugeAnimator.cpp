@@ -0,0 +1,141 @@
+/*
+ * gipGaugeAnimator.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeAnimator.h"
+#include "gipGauge.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define GIPGAUGE_ANIMATOR_SSE 1
+#endif
+
+gipGaugeAnimator::gipGaugeAnimator() {
+    hasupdated = false;
+}
+
+gipGaugeAnimator::~gipGaugeAnimator() {
+    // Leave attached gauges animating on their own
+    for (gipGauge* owner : owners) {
+        if (owner) owner->detachAnimator();
+    }
+}
+
+void gipGaugeAnimator::update(float deltaTime) {
+    if (current.empty() || deltaTime <= 0.0f) return;
+    // Exponential decay covers the same distance per second at any frame rate
+    factors.resize(speeds.size());
+    for (size_t i = 0; i < speeds.size(); i++) factors[i] = 1.0f - std::exp(-speeds[i] * deltaTime);
+    advance(current.data(), target.data(), speedindex.data(), factors.data(), current.size());
+}
+
+void gipGaugeAnimator::update() {
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    float deltaTime = 1.0f / 60.0f;
+    if (hasupdated) {
+        deltaTime = std::chrono::duration<float>(now - lastupdatetime).count();
+        deltaTime = std::min(deltaTime, 0.25f);  // Don't jump after stalls
+    }
+    lastupdatetime = now;
+    hasupdated = true;
+    update(deltaTime);
+}
+
+void gipGaugeAnimator::advance(float* current, const float* target, const int* speedindex, const float* factors,
+                               int count) {
+    int i = 0;
+#ifdef GIPGAUGE_ANIMATOR_SSE
+    const __m128 epsilon = _mm_set1_ps(0.001f);
+    const __m128 absmask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    for (; i + 4 <= count; i += 4) {
+        __m128 c = _mm_loadu_ps(current + i);
+        __m128 t = _mm_loadu_ps(target + i);
+        __m128 difference = _mm_sub_ps(t, c);
+        __m128 factor = _mm_set_ps(factors[speedindex[i + 3]], factors[speedindex[i + 2]],
+                                   factors[speedindex[i + 1]], factors[speedindex[i]]);
+        __m128 next = _mm_add_ps(c, _mm_mul_ps(factor, difference));
+        // Snap to the target once within the same epsilon as gipGauge
+        __m128 moving = _mm_cmpgt_ps(_mm_and_ps(difference, absmask), epsilon);
+        _mm_storeu_ps(current + i, _mm_or_ps(_mm_and_ps(moving, next), _mm_andnot_ps(moving, t)));
+    }
+#endif
+    for (; i < count; i++) {
+        float difference = target[i] - current[i];
+        current[i] = std::abs(difference) > 0.001f ? current[i] + factors[speedindex[i]] * difference : target[i];
+    }
+}
+
+int gipGaugeAnimator::addSlot(gipGauge* owner, float value) {
+    if (!freeslots.empty()) {
+        int slot = freeslots.back();
+        freeslots.pop_back();
+        current[slot] = value;
+        target[slot] = value;
+        owners[slot] = owner;
+        return slot;
+    }
+    current.push_back(value);
+    target.push_back(value);
+    speedindex.push_back(acquireSpeed(0.0f));
+    owners.push_back(owner);
+    return current.size() - 1;
+}
+
+void gipGaugeAnimator::removeSlot(int slot) {
+    if (slot < 0 || slot >= static_cast<int>(current.size())) return;
+    // Freed slots stay in the arrays as settled entries with speed 0 until reused
+    target[slot] = current[slot];
+    setSpeed(slot, 0.0f);
+    owners[slot] = nullptr;
+    freeslots.push_back(slot);
+}
+
+int gipGaugeAnimator::getSlotNum() const {
+    return current.size() - freeslots.size();
+}
+
+void gipGaugeAnimator::setTarget(int slot, float value) {
+    target[slot] = value;
+}
+
+void gipGaugeAnimator::setCurrent(int slot, float value) {
+    current[slot] = value;
+}
+
+void gipGaugeAnimator::setSpeed(int slot, float value) {
+    if (speeds[speedindex[slot]] == value) return;
+    speedusers[speedindex[slot]]--;
+    speedindex[slot] = acquireSpeed(value);
+}
+
+float gipGaugeAnimator::getCurrent(int slot) const {
+    return current[slot];
+}
+
+float gipGaugeAnimator::getTarget(int slot) const {
+    return target[slot];
+}
+
+int gipGaugeAnimator::acquireSpeed(float value) {
+    // Few distinct speeds are in use, a linear search is enough
+    int unused = -1;
+    for (size_t i = 0; i < speeds.size(); i++) {
+        if (speeds[i] == value) {
+            speedusers[i]++;
+            return i;
+        }
+        if (speedusers[i] == 0 && unused < 0) unused = i;
+    }
+    if (unused < 0) {
+        unused = speeds.size();
+        speeds.push_back(value);
+        speedusers.push_back(0);
+    }
+    speeds[unused] = value;
+    speedusers[unused] = 1;
+    return unused;
+}
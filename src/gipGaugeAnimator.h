@@ -0,0 +1,64 @@
+/*
+ * gipGaugeAnimator.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGEANIMATOR_H_
+#define SRC_GIPGAUGEANIMATOR_H_
+
+#include <vector>
+#include <chrono>
+
+class gipGauge;
+
+// Batched animation engine. Current, target and speed of every attached gauge
+// are kept in structure-of-arrays form and advanced by one vectorized kernel
+// per frame using the real frame delta time. Slots refer to a small table of
+// distinct speeds, so the decay factor is computed once per distinct speed
+// per frame rather than once per gauge. Call update() once per frame
+// before drawing the gauges. Gauges still attached when the animator is
+// destroyed fall back to animating themselves.
+class gipGaugeAnimator {
+public:
+    gipGaugeAnimator();
+    virtual ~gipGaugeAnimator();
+
+    // Advances every slot by the given delta time in seconds
+    void update(float deltaTime);
+    // Advances every slot by the wall-clock time since the previous update
+    void update();
+
+    // Slot management, normally done through gipGauge::setAnimator()
+    int addSlot(gipGauge* owner, float value);
+    void removeSlot(int slot);
+    int getSlotNum() const;
+
+    void setTarget(int slot, float target);
+    void setCurrent(int slot, float value);
+    void setSpeed(int slot, float speed);
+    float getCurrent(int slot) const;
+    float getTarget(int slot) const;
+
+private:
+    std::vector<float> current;
+    std::vector<float> target;
+    std::vector<int> speedindex;        // Into speeds
+    std::vector<gipGauge*> owners;
+    std::vector<int> freeslots;
+
+    // Distinct speeds, the slots using each, and their decay factors for the
+    // current frame
+    std::vector<float> speeds;
+    std::vector<int> speedusers;
+    std::vector<float> factors;
+
+    std::chrono::steady_clock::time_point lastupdatetime;
+    bool hasupdated;
+
+    int acquireSpeed(float speed);
+    static void advance(float* current, const float* target, const int* speedindex, const float* factors,
+                        int count);
+};
+
+#endif /* SRC_GIPGAUGEANIMATOR_H_ */
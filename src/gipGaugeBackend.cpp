@@ -0,0 +1,80 @@
+/*
+ * gipGaugeBackend.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeBackend.h"
+#include "gipGaugeDrawList.h"
+#include "gipGaugeTextAtlas.h"
+#include "gRenderer.h"
+
+void gipGaugeBackend::drawRetained(const gipGaugeDrawList& layer) {
+    layer.replay(*this);
+}
+
+void gipGaugeBackend::measureText(const std::string& text, int fontSize, float& width, float& height) {
+    // Same average glyph width the gauge uses to center its title
+    width = text.size() * (6.0f + fontSize * 2.0f);
+    height = 12.0f + fontSize * 4.0f;
+}
+
+gipGaugeRendererBackend::gipGaugeRendererBackend() {
+    textatlas = nullptr;
+}
+
+gipGaugeRendererBackend::~gipGaugeRendererBackend() {
+}
+
+gipGaugeRendererBackend* gipGaugeRendererBackend::getDefault() {
+    static gipGaugeRendererBackend defaultbackend;
+    return &defaultbackend;
+}
+
+void gipGaugeRendererBackend::setTextAtlas(gipGaugeTextAtlas* atlas) {
+    textatlas = atlas;
+}
+
+gipGaugeTextAtlas* gipGaugeRendererBackend::getTextAtlas() const {
+    return textatlas;
+}
+
+void gipGaugeRendererBackend::setColor(const gColor& color) {
+    currentcolor = color;
+    renderer->setColor(color);
+}
+
+void gipGaugeRendererBackend::drawLine(float x1, float y1, float x2, float y2) {
+    renderer->drawLine(x1, y1, x2, y2);
+}
+
+void gipGaugeRendererBackend::drawArc(float x, float y, float radius, float startAngle, float endAngle, bool filled, int segments) {
+    renderer->drawArc(x, y, radius, startAngle, endAngle, filled, segments);
+}
+
+void gipGaugeRendererBackend::drawCircle(float x, float y, float radius, bool filled, int segments) {
+    renderer->drawCircle(x, y, radius, filled, segments);
+}
+
+void gipGaugeRendererBackend::drawRectangle(float x, float y, float w, float h, bool filled) {
+    renderer->drawRectangle(x, y, w, h, filled);
+}
+
+void gipGaugeRendererBackend::drawText(const std::string& text, float x, float y, int fontSize) {
+    if (textatlas) textatlas->drawLabel(text, x, y, fontSize, currentcolor);
+    else renderer->drawText(text, x, y, fontSize);
+}
+
+void gipGaugeRendererBackend::drawValueText(const std::string& text, float x, float y, int fontSize) {
+    if (textatlas) textatlas->drawValue(text, x, y, fontSize, currentcolor);
+    else renderer->drawText(text, x, y, fontSize);
+}
+
+void gipGaugeRendererBackend::measureText(const std::string& text, int fontSize, float& width, float& height) {
+    if (textatlas == nullptr) {
+        gipGaugeBackend::measureText(text, fontSize, width, height);
+        return;
+    }
+    width = textatlas->getTextWidth(text, fontSize);
+    height = textatlas->getLineHeight(fontSize);
+}
@@ -0,0 +1,77 @@
+/*
+ * gipGaugeBackend.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGEBACKEND_H_
+#define SRC_GIPGAUGEBACKEND_H_
+
+#include "gColor.h"
+#include <string>
+
+class gipGaugeTextAtlas;
+class gipGaugeDrawList;
+
+// Drawing interface used by gipGauge. The default implementation forwards to
+// the global GlistEngine renderer; other implementations batch, record or
+// measure the primitives without touching the GPU.
+class gipGaugeBackend {
+public:
+    // Draw stages, reported before each stage's primitives
+    enum Layer {
+        LAYER_BACKGROUND = 0,
+        LAYER_ZONES,
+        LAYER_TICKS,
+        LAYER_NEEDLE,
+        LAYER_TEXT
+    };
+
+    virtual ~gipGaugeBackend() {}
+
+    virtual void setLayer(int /*layer*/) {}
+    virtual void setColor(const gColor& color) = 0;
+    virtual void drawLine(float x1, float y1, float x2, float y2) = 0;
+    virtual void drawArc(float x, float y, float radius, float startAngle, float endAngle, bool filled, int segments) = 0;
+    virtual void drawCircle(float x, float y, float radius, bool filled, int segments) = 0;
+    virtual void drawRectangle(float x, float y, float w, float h, bool filled) = 0;
+    virtual void drawText(const std::string& text, float x, float y, int fontSize) = 0;
+    // Text that changes every frame, such as the value readout
+    virtual void drawValueText(const std::string& text, float x, float y, int fontSize) {
+        drawText(text, x, y, fontSize);
+    }
+    // Static layer recorded by a retained-mode gauge, replayed by default
+    virtual void drawRetained(const gipGaugeDrawList& layer);
+    // Text extents in pixels, estimated from the character count by default
+    virtual void measureText(const std::string& text, int fontSize, float& width, float& height);
+};
+
+// Immediate-mode backend drawing through the global renderer
+class gipGaugeRendererBackend : public gipGaugeBackend {
+public:
+    gipGaugeRendererBackend();
+    virtual ~gipGaugeRendererBackend();
+
+    // Shared instance used by gauges without an explicit backend
+    static gipGaugeRendererBackend* getDefault();
+
+    // Draws text as textured quads from a pre-rasterized atlas, nullptr
+    // draws text through the renderer every frame
+    void setTextAtlas(gipGaugeTextAtlas* atlas);
+    gipGaugeTextAtlas* getTextAtlas() const;
+
+    void setColor(const gColor& color);
+    void drawLine(float x1, float y1, float x2, float y2);
+    void drawArc(float x, float y, float radius, float startAngle, float endAngle, bool filled, int segments);
+    void drawCircle(float x, float y, float radius, bool filled, int segments);
+    void drawRectangle(float x, float y, float w, float h, bool filled);
+    void drawText(const std::string& text, float x, float y, int fontSize);
+    void drawValueText(const std::string& text, float x, float y, int fontSize);
+    void measureText(const std::string& text, int fontSize, float& width, float& height);
+
+private:
+    gipGaugeTextAtlas* textatlas;
+    gColor currentcolor;
+};
+
+#endif /* SRC_GIPGAUGEBACKEND_H_ */
@@ -0,0 +1,367 @@
+/*
+ * gipGaugeBatch.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeBatch.h"
+#include "gipGauge.h"
+#include "gipGaugeThreadPool.h"
+#include <algorithm>
+#include <atomic>
+
+gipGaugeBatch::gipGaugeBatch() {
+    target = gipGaugeRendererBackend::getDefault();
+    cullingenabled = false;
+    viewport = {0, 0, 0, 0};
+    cullmargin = 16;
+    visiblegauges = 0;
+    threadpool = nullptr;
+    currentlayer = LAYER_BACKGROUND;
+    currentcolor = -1;
+    statechanges = 0;
+    textnum = 0;
+    GIPGAUGE_COUNT(workerallocations = 0);
+}
+
+gipGaugeBatch::~gipGaugeBatch() {
+    clear();
+}
+
+void gipGaugeBatch::addGauge(gipGauge* gauge, int x, int y, int w, int h) {
+    if (gauge == nullptr) return;
+    for (GaugeEntry& entry : gauges) {
+        if (entry.gauge == gauge) {
+            entry.x = x;
+            entry.y = y;
+            entry.w = w;
+            entry.h = h;
+            return;
+        }
+    }
+    gauges.push_back({gauge, x, y, w, h});
+}
+
+void gipGaugeBatch::setGaugeRect(gipGauge* gauge, int x, int y, int w, int h) {
+    addGauge(gauge, x, y, w, h);
+}
+
+void gipGaugeBatch::removeGauge(gipGauge* gauge) {
+    for (size_t i = 0; i < gauges.size(); i++) {
+        if (gauges[i].gauge == gauge) {
+            gauges.erase(gauges.begin() + i);
+            return;
+        }
+    }
+}
+
+void gipGaugeBatch::clear() {
+    gauges.clear();
+    primitives.clear();
+    colors.clear();
+    texts.clear();
+    textnum = 0;
+}
+
+int gipGaugeBatch::getGaugeNum() const {
+    return gauges.size();
+}
+
+void gipGaugeBatch::bindTelemetry(gipGaugeTelemetry* telemetry, int firstSlot) {
+    for (size_t i = 0; i < gauges.size(); i++) {
+        gauges[i].gauge->bindTelemetry(telemetry, firstSlot + i);
+    }
+}
+
+void gipGaugeBatch::bindAlarms(gipGaugeAlarmSink* sink) {
+    for (GaugeEntry& entry : gauges) entry.gauge->setAlarmSink(sink);
+}
+
+void gipGaugeBatch::setViewport(int x, int y, int w, int h) {
+    viewport = {x, y, w, h};
+    cullingenabled = true;
+}
+
+void gipGaugeBatch::clearViewport() {
+    cullingenabled = false;
+}
+
+void gipGaugeBatch::addOccluder(int x, int y, int w, int h) {
+    occluders.push_back({x, y, w, h});
+}
+
+void gipGaugeBatch::clearOccluders() {
+    occluders.clear();
+}
+
+void gipGaugeBatch::setCullMargin(int margin) {
+    cullmargin = std::max(0, margin);
+}
+
+int gipGaugeBatch::getVisibleGaugeNum() const {
+    return visiblegauges;
+}
+
+bool gipGaugeBatch::isVisible(const GaugeEntry& entry) const {
+    int left = entry.x - cullmargin;
+    int top = entry.y - cullmargin;
+    int right = entry.x + entry.w + cullmargin;
+    int bottom = entry.y + entry.h + cullmargin;
+
+    if (cullingenabled) {
+        if (right <= viewport.x || left >= viewport.x + viewport.w) return false;
+        if (bottom <= viewport.y || top >= viewport.y + viewport.h) return false;
+    }
+
+    // Only a single occluder covering the whole gauge hides it
+    for (const Rect& occluder : occluders) {
+        if (left >= occluder.x && right <= occluder.x + occluder.w &&
+            top >= occluder.y && bottom <= occluder.y + occluder.h) return false;
+    }
+    return true;
+}
+
+void gipGaugeBatch::setBackend(gipGaugeBackend* backend) {
+    target = backend ? backend : gipGaugeRendererBackend::getDefault();
+}
+
+gipGaugeBackend* gipGaugeBatch::getBackend() const {
+    return target;
+}
+
+void gipGaugeBatch::setThreadPool(gipGaugeThreadPool* pool) {
+    threadpool = pool;
+}
+
+gipGaugeThreadPool* gipGaugeBatch::getThreadPool() const {
+    return threadpool;
+}
+
+void gipGaugeBatch::prepareStale() {
+    staleentries.clear();
+    for (const GaugeEntry& entry : gauges) {
+        if (isVisible(entry) && entry.gauge->needsPrepare(entry.x, entry.y, entry.w, entry.h)) {
+            staleentries.push_back(&entry);
+        }
+    }
+    if (staleentries.size() < 2) return;
+
+    // Each task writes only its own gauge's caches, nothing is shared to merge.
+    // Labels are measured through this batch, as during collection.
+#ifdef GIPGAUGE_ENABLE_STATS
+    // Allocations are counted per thread, sum those made inside the tasks.
+    // The calling thread's share is already in its own count.
+    std::atomic<uint64_t> taskallocations(0);
+    uint64_t callerstart = gipGaugeCounters::getBufferAllocationNum();
+#endif
+    threadpool->parallelFor(staleentries.size(), [&](int i) {
+        GIPGAUGE_COUNT(uint64_t start = gipGaugeCounters::getBufferAllocationNum());
+        const GaugeEntry& entry = *staleentries[i];
+        gipGaugeBackend* previous = entry.gauge->backend;
+        entry.gauge->backend = this;
+        entry.gauge->prepare(entry.x, entry.y, entry.w, entry.h);
+        entry.gauge->backend = previous;
+        GIPGAUGE_COUNT(taskallocations += gipGaugeCounters::getBufferAllocationNum() - start);
+    });
+#ifdef GIPGAUGE_ENABLE_STATS
+    workerallocations = taskallocations - (gipGaugeCounters::getBufferAllocationNum() - callerstart);
+#endif
+}
+
+void gipGaugeBatch::draw() {
+#ifdef GIPGAUGE_ENABLE_STATS
+    std::chrono::steady_clock::time_point framestart = std::chrono::steady_clock::now();
+    uint64_t allocationstart = gipGaugeCounters::getBufferAllocationNum();
+    framecounters.reset();
+    workerallocations = 0;
+#endif
+    primitives.clear();
+    colors.clear();
+    // Strings are kept and assigned into, their storage outlives the frame
+    textnum = 0;
+
+    if (threadpool) prepareStale();
+
+    // Collect
+    visiblegauges = 0;
+    for (const GaugeEntry& entry : gauges) {
+        if (!isVisible(entry)) {
+            // Keep ingestion and animation current for when it scrolls back in
+            entry.gauge->update();
+            continue;
+        }
+        visiblegauges++;
+        currentlayer = LAYER_BACKGROUND;
+        currentcolor = -1;
+        gipGaugeBackend* previous = entry.gauge->backend;
+        entry.gauge->backend = this;
+        entry.gauge->draw(entry.x, entry.y, entry.w, entry.h);
+        entry.gauge->backend = previous;
+        GIPGAUGE_COUNT(framecounters.add(entry.gauge->getFrameCounters()));
+    }
+
+    // Sort by layer, then primitive kind, then color. Within the needle and
+    // text layers a gauge draws overlays on top of its own bar and needle, so
+    // those layers keep their submission order. Primitives sharing all keys
+    // keep their submission order too, through the order key rather than a
+    // stable sort, which would allocate a temporary buffer every frame.
+    std::sort(primitives.begin(), primitives.end(),
+            [](const Primitive& a, const Primitive& b) {
+        if (a.layer != b.layer) return a.layer < b.layer;
+        if (a.layer >= LAYER_NEEDLE) return a.order < b.order;
+        if (a.type != b.type) return a.type < b.type;
+        if (a.filled != b.filled) return a.filled;
+        if (a.color != b.color) return a.color < b.color;
+        return a.order < b.order;
+    });
+
+    submit();
+
+#ifdef GIPGAUGE_ENABLE_STATS
+    framecounters.frames = 1;
+    framecounters.frametime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - framestart).count();
+    framecounters.bufferallocations = gipGaugeCounters::getBufferAllocationNum() - allocationstart + workerallocations;
+    framecounters.colorchanges = statechanges;
+    counters.add(framecounters);
+#endif
+}
+
+void gipGaugeBatch::submit() {
+    statechanges = 0;
+    int lastcolor = -1;
+    int lastlayer = -1;
+    for (const Primitive& prim : primitives) {
+        // Layers arrive in order, targets such as the mesh builder split on them
+        if (prim.layer != lastlayer) {
+            target->setLayer(prim.layer);
+            lastlayer = prim.layer;
+        }
+        if (prim.color != lastcolor && prim.color >= 0) {
+            target->setColor(colors[prim.color]);
+            lastcolor = prim.color;
+            statechanges++;
+        }
+
+        switch(prim.type) {
+            case PRIMITIVE_LINE:
+                target->drawLine(prim.p[0], prim.p[1], prim.p[2], prim.p[3]);
+                break;
+            case PRIMITIVE_ARC:
+                target->drawArc(prim.p[0], prim.p[1], prim.p[2], prim.p[3], prim.p[4], prim.filled, prim.segments);
+                break;
+            case PRIMITIVE_CIRCLE:
+                target->drawCircle(prim.p[0], prim.p[1], prim.p[2], prim.filled, prim.segments);
+                break;
+            case PRIMITIVE_RECTANGLE:
+                target->drawRectangle(prim.p[0], prim.p[1], prim.p[2], prim.p[3], prim.filled);
+                break;
+            case PRIMITIVE_TEXT:
+                if (prim.filled) target->drawValueText(texts[prim.text], prim.p[0], prim.p[1], prim.segments);
+                else target->drawText(texts[prim.text], prim.p[0], prim.p[1], prim.segments);
+                break;
+        }
+    }
+}
+
+void gipGaugeBatch::setLayer(int layer) {
+    currentlayer = layer;
+}
+
+void gipGaugeBatch::setColor(const gColor& color) {
+    currentcolor = findColor(color);
+}
+
+int gipGaugeBatch::findColor(const gColor& color) {
+    // Dashboards use a handful of colors, a linear scan beats hashing here
+    for (size_t i = 0; i < colors.size(); i++) {
+        const gColor& c = colors[i];
+        if (c.r == color.r && c.g == color.g && c.b == color.b && c.a == color.a) return i;
+    }
+    colors.push_back(color);
+    return colors.size() - 1;
+}
+
+void gipGaugeBatch::addPrimitive(int type, bool filled, int segments, int text,
+                                 float p0, float p1, float p2, float p3, float p4, float p5) {
+    Primitive prim;
+    prim.layer = currentlayer;
+    prim.type = type;
+    prim.color = currentcolor;
+    prim.filled = filled;
+    prim.segments = segments;
+    prim.text = text;
+    prim.order = primitives.size();
+    prim.p[0] = p0;
+    prim.p[1] = p1;
+    prim.p[2] = p2;
+    prim.p[3] = p3;
+    prim.p[4] = p4;
+    prim.p[5] = p5;
+    primitives.push_back(prim);
+}
+
+void gipGaugeBatch::drawLine(float x1, float y1, float x2, float y2) {
+    addPrimitive(PRIMITIVE_LINE, false, 0, -1, x1, y1, x2, y2, 0, 0);
+}
+
+void gipGaugeBatch::drawArc(float x, float y, float radius, float startAngle, float endAngle, bool filled, int segments) {
+    addPrimitive(PRIMITIVE_ARC, filled, segments, -1, x, y, radius, startAngle, endAngle, 0);
+}
+
+void gipGaugeBatch::drawCircle(float x, float y, float radius, bool filled, int segments) {
+    addPrimitive(PRIMITIVE_CIRCLE, filled, segments, -1, x, y, radius, 0, 0, 0);
+}
+
+void gipGaugeBatch::drawRectangle(float x, float y, float w, float h, bool filled) {
+    addPrimitive(PRIMITIVE_RECTANGLE, filled, 0, -1, x, y, w, h, 0, 0);
+}
+
+void gipGaugeBatch::drawText(const std::string& text, float x, float y, int fontSize) {
+    addPrimitive(PRIMITIVE_TEXT, false, fontSize, storeText(text), x, y, 0, 0, 0, 0);
+}
+
+void gipGaugeBatch::drawValueText(const std::string& text, float x, float y, int fontSize) {
+    addPrimitive(PRIMITIVE_TEXT, true, fontSize, storeText(text), x, y, 0, 0, 0, 0);
+}
+
+int gipGaugeBatch::storeText(const std::string& text) {
+    if (textnum < static_cast<int>(texts.size())) texts[textnum].assign(text);
+    else texts.push_back(text);
+    return textnum++;
+}
+
+void gipGaugeBatch::measureText(const std::string& text, int fontSize, float& width, float& height) {
+    target->measureText(text, fontSize, width, height);
+}
+
+int gipGaugeBatch::getPrimitiveNum() const {
+    return primitives.size();
+}
+
+int gipGaugeBatch::getStateChangeNum() const {
+    return statechanges;
+}
+
+const gipGaugeCounters& gipGaugeBatch::getCounters() const {
+#ifdef GIPGAUGE_ENABLE_STATS
+    return counters;
+#else
+    return gipGaugeCounters::getEmpty();
+#endif
+}
+
+const gipGaugeCounters& gipGaugeBatch::getFrameCounters() const {
+#ifdef GIPGAUGE_ENABLE_STATS
+    return framecounters;
+#else
+    return gipGaugeCounters::getEmpty();
+#endif
+}
+
+void gipGaugeBatch::resetCounters() {
+#ifdef GIPGAUGE_ENABLE_STATS
+    counters.reset();
+    framecounters.reset();
+#endif
+}
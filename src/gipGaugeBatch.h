@@ -0,0 +1,152 @@
+/*
+ * gipGaugeBatch.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGEBATCH_H_
+#define SRC_GIPGAUGEBATCH_H_
+
+#include "gipGaugeBackend.h"
+#include "gipGaugeCounters.h"
+#include <vector>
+#include <string>
+
+class gipGauge;
+class gipGaugeTelemetry;
+class gipGaugeAlarmSink;
+class gipGaugeThreadPool;
+
+// Collects the primitives of all registered gauges for a frame and submits
+// them sorted by layer. Layers are drawn in order: backgrounds, zones, ticks,
+// needles/bars, then text, so overlapping gauges are composited per layer
+// rather than per gauge. The static layers are further sorted by primitive
+// kind and color, the needle and text layers keep submission order.
+class gipGaugeBatch : public gipGaugeBackend {
+public:
+    enum PrimitiveType {
+        PRIMITIVE_LINE = 0,
+        PRIMITIVE_ARC,
+        PRIMITIVE_CIRCLE,
+        PRIMITIVE_RECTANGLE,
+        PRIMITIVE_TEXT
+    };
+
+    gipGaugeBatch();
+    virtual ~gipGaugeBatch();
+
+    // Gauge registration
+    void addGauge(gipGauge* gauge, int x, int y, int w, int h);
+    void setGaugeRect(gipGauge* gauge, int x, int y, int w, int h);
+    void removeGauge(gipGauge* gauge);
+    // Removes every gauge. The viewport and occluders describe the screen,
+    // not the gauges, and are kept.
+    void clear();
+    int getGaugeNum() const;
+    // Binds the registered gauges, in order, to consecutive telemetry slots
+    void bindTelemetry(gipGaugeTelemetry* telemetry, int firstSlot = 0);
+    // Sends the zone events of the registered gauges to one sink
+    void bindAlarms(gipGaugeAlarmSink* sink);
+
+    // Visibility culling. Gauges outside the viewport or fully covered by a
+    // single opaque occluder are not drawn, but their values keep updating.
+    // A gauge covered only by several occluders together stays visible.
+    void setViewport(int x, int y, int w, int h);
+    void clearViewport();
+    void addOccluder(int x, int y, int w, int h);
+    void clearOccluders();
+    // Extra pixels around a gauge rect for text drawn outside of it
+    void setCullMargin(int margin);
+    int getVisibleGaugeNum() const;
+
+    // Gauges whose cached geometry is stale, after a resize or a range or
+    // theme change, are prepared in parallel on the pool before collection.
+    // Collection and submission stay on the calling thread. nullptr disables.
+    // Allocations made by the workers count towards the frame counters.
+    void setThreadPool(gipGaugeThreadPool* pool);
+    gipGaugeThreadPool* getThreadPool() const;
+
+    // Backend receiving the sorted primitives, nullptr selects the renderer
+    void setBackend(gipGaugeBackend* backend);
+    gipGaugeBackend* getBackend() const;
+
+    // Collects every registered gauge and submits the sorted primitives
+    void draw();
+
+    // Primitive collection, called by the gauges while the batch is collecting
+    void setLayer(int layer);
+    void setColor(const gColor& color);
+    void drawLine(float x1, float y1, float x2, float y2);
+    void drawArc(float x, float y, float radius, float startAngle, float endAngle, bool filled, int segments);
+    void drawCircle(float x, float y, float radius, bool filled, int segments);
+    void drawRectangle(float x, float y, float w, float h, bool filled);
+    void drawText(const std::string& text, float x, float y, int fontSize);
+    void drawValueText(const std::string& text, float x, float y, int fontSize);
+    // Measured by the target backend the text will finally be drawn with
+    void measureText(const std::string& text, int fontSize, float& width, float& height);
+
+    // Statistics of the last draw() call
+    int getPrimitiveNum() const;
+    int getStateChangeNum() const;
+
+    // Dashboard counters, collected only with GIPGAUGE_ENABLE_STATS. A frame
+    // sums the stage times, primitives and animation steps of the drawn
+    // gauges; frame time, buffer allocations and color changes cover the whole
+    // draw() including sorting and submission. Zeroed without the flag.
+    const gipGaugeCounters& getCounters() const;
+    const gipGaugeCounters& getFrameCounters() const;
+    void resetCounters();
+
+private:
+    struct GaugeEntry {
+        gipGauge* gauge;
+        int x, y, w, h;
+    };
+
+    struct Rect {
+        int x, y, w, h;
+    };
+
+    struct Primitive {
+        int layer;
+        int type;
+        int color;      // Index into colors
+        bool filled;    // Dynamic text for PRIMITIVE_TEXT
+        int segments;   // Arc/circle segments, or font size for text
+        int text;       // Index into texts, -1 if none
+        int order;      // Submission index, the last sort key
+        float p[6];
+    };
+
+    std::vector<GaugeEntry> gauges;
+    gipGaugeVector<Primitive> primitives;
+    gipGaugeVector<gColor> colors;
+    gipGaugeVector<std::string> texts;  // The first textnum are this frame's
+    int textnum;
+    gipGaugeBackend* target;
+    bool cullingenabled;
+    Rect viewport;
+    std::vector<Rect> occluders;
+    int cullmargin;
+    int visiblegauges;
+    gipGaugeThreadPool* threadpool;
+    gipGaugeVector<const GaugeEntry*> staleentries;
+    int currentlayer;
+    int currentcolor;
+    int statechanges;
+#ifdef GIPGAUGE_ENABLE_STATS
+    gipGaugeCounters counters;
+    gipGaugeCounters framecounters;
+    uint64_t workerallocations;     // Made on the pool's workers this frame
+#endif
+
+    bool isVisible(const GaugeEntry& entry) const;
+    int findColor(const gColor& color);
+    int storeText(const std::string& text);
+    void addPrimitive(int type, bool filled, int segments, int text,
+                      float p0, float p1, float p2, float p3, float p4, float p5);
+    void prepareStale();
+    void submit();
+};
+
+#endif /* SRC_GIPGAUGEBATCH_H_ */
@@ -0,0 +1,57 @@
+/*
+ * gipGaugeBinary.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGEBINARY_H_
+#define SRC_GIPGAUGEBINARY_H_
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// Helpers for the native-endian binary snapshots of gauges and their parts.
+// Readers advance a cursor and fail without reading past the end.
+namespace gipGaugeBinary {
+
+inline void appendBytes(std::vector<uint8_t>& out, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    out.insert(out.end(), bytes, bytes + size);
+}
+
+template<typename T>
+inline void append(std::vector<uint8_t>& out, const T& value) {
+    appendBytes(out, &value, sizeof(T));
+}
+
+template<typename T>
+inline void appendVector(std::vector<uint8_t>& out, const std::vector<T>& values) {
+    append(out, static_cast<uint64_t>(values.size()));
+    if (!values.empty()) appendBytes(out, values.data(), values.size() * sizeof(T));
+}
+
+inline bool readBytes(const uint8_t*& cursor, const uint8_t* end, void* data, size_t size) {
+    if (static_cast<size_t>(end - cursor) < size) return false;
+    std::memcpy(data, cursor, size);
+    cursor += size;
+    return true;
+}
+
+template<typename T>
+inline bool read(const uint8_t*& cursor, const uint8_t* end, T& value) {
+    return readBytes(cursor, end, &value, sizeof(T));
+}
+
+template<typename T>
+inline bool readVector(const uint8_t*& cursor, const uint8_t* end, std::vector<T>& values) {
+    uint64_t size;
+    if (!read(cursor, end, size) || size > static_cast<uint64_t>(end - cursor) / sizeof(T)) return false;
+    values.resize(size);
+    return size == 0 || readBytes(cursor, end, values.data(), size * sizeof(T));
+}
+
+}
+
+#endif /* SRC_GIPGAUGEBINARY_H_ */
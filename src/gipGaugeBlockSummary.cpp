@@ -0,0 +1,62 @@
+/*
+ * gipGaugeBlockSummary.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeBlockSummary.h"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define GIPGAUGE_BLOCKSUMMARY_SSE 1
+#endif
+
+// Float lanes are flushed into the double totals this often to bound rounding
+static const size_t flushinterval = 1024;
+
+void gipGaugeBlockSummary::reduce(const float* samples, size_t n) {
+    reset();
+    if (n == 0) return;
+
+    count = static_cast<uint32_t>(std::min<size_t>(n, UINT32_MAX));
+    last = samples[n - 1];
+    min = max = samples[0];
+
+    size_t i = 0;
+#ifdef GIPGAUGE_BLOCKSUMMARY_SSE
+    if (n >= 4) {
+        __m128 vmin = _mm_loadu_ps(samples);
+        __m128 vmax = vmin;
+        float lanes[4];
+        while (i + 4 <= n) {
+            // Four independent accumulators per chunk, folded into doubles
+            size_t end = std::min(n & ~static_cast<size_t>(3), i + flushinterval);
+            __m128 vsum = _mm_setzero_ps();
+            __m128 vsquares = _mm_setzero_ps();
+            for (; i < end; i += 4) {
+                __m128 v = _mm_loadu_ps(samples + i);
+                vmin = _mm_min_ps(vmin, v);
+                vmax = _mm_max_ps(vmax, v);
+                vsum = _mm_add_ps(vsum, v);
+                vsquares = _mm_add_ps(vsquares, _mm_mul_ps(v, v));
+            }
+            _mm_storeu_ps(lanes, vsum);
+            sum += static_cast<double>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+            _mm_storeu_ps(lanes, vsquares);
+            sumsquares += static_cast<double>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+        }
+        _mm_storeu_ps(lanes, vmin);
+        min = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+        _mm_storeu_ps(lanes, vmax);
+        max = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+    }
+#endif
+    for (; i < n; i++) {
+        float v = samples[i];
+        min = std::min(min, v);
+        max = std::max(max, v);
+        sum += v;
+        sumsquares += static_cast<double>(v) * v;
+    }
+}
@@ -0,0 +1,54 @@
+/*
+ * gipGaugeBlockSummary.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGEBLOCKSUMMARY_H_
+#define SRC_GIPGAUGEBLOCKSUMMARY_H_
+
+#include <cstddef>
+#include <cstdint>
+
+// Everything a gauge needs to know about a block of samples, reduced in a
+// single pass: count, last, extremes, sum and sum of squares. Summaries merge
+// associatively, so blocks from one frame collapse into one summary without
+// losing a spike.
+struct gipGaugeBlockSummary {
+    uint32_t count;
+    float last;
+    float min;
+    float max;
+    double sum;
+    double sumsquares;
+
+    gipGaugeBlockSummary() {
+        reset();
+    }
+
+    void reset() {
+        count = 0;
+        last = min = max = 0.0f;
+        sum = sumsquares = 0.0;
+    }
+
+    // Folds in a newer summary
+    void merge(const gipGaugeBlockSummary& newer) {
+        if (newer.count == 0) return;
+        if (count == 0) {
+            *this = newer;
+            return;
+        }
+        count += newer.count;
+        last = newer.last;
+        if (newer.min < min) min = newer.min;
+        if (newer.max > max) max = newer.max;
+        sum += newer.sum;
+        sumsquares += newer.sumsquares;
+    }
+
+    // Vectorized reduction of a whole block, replaces the summary
+    void reduce(const float* samples, size_t n);
+};
+
+#endif /* SRC_GIPGAUGEBLOCKSUMMARY_H_ */
@@ -0,0 +1,183 @@
+/*
+ * gipGaugeCounters.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeCounters.h"
+#include "gipGaugeDrawList.h"
+#include "gRenderer.h"
+#include <cstdio>
+
+#ifdef GIPGAUGE_ENABLE_STATS
+static thread_local uint64_t allocationnum = 0;
+
+void gipGaugeCountBufferAllocation() {
+    allocationnum++;
+}
+#endif
+
+gipGaugeCounters::gipGaugeCounters() {
+    reset();
+}
+
+void gipGaugeCounters::reset() {
+    frames = 0;
+    frametime = 0;
+    for (int i = 0; i < STAGE_NUM; i++) {
+        stagetime[i] = 0;
+        stagecalls[i] = 0;
+    }
+    primitives = 0;
+    colorchanges = 0;
+    bufferallocations = 0;
+    animationsteps = 0;
+}
+
+void gipGaugeCounters::add(const gipGaugeCounters& other) {
+    frames += other.frames;
+    frametime += other.frametime;
+    for (int i = 0; i < STAGE_NUM; i++) {
+        stagetime[i] += other.stagetime[i];
+        stagecalls[i] += other.stagecalls[i];
+    }
+    primitives += other.primitives;
+    colorchanges += other.colorchanges;
+    bufferallocations += other.bufferallocations;
+    animationsteps += other.animationsteps;
+}
+
+double gipGaugeCounters::getFrameTimeMs() const {
+    return frames ? frametime * 1e-6 / frames : 0.0;
+}
+
+double gipGaugeCounters::getStageTimeMs(int stage) const {
+    return frames ? stagetime[stage] * 1e-6 / frames : 0.0;
+}
+
+const char* gipGaugeCounters::getStageName(int stage) {
+    static const char* names[STAGE_NUM] = {"background", "zones", "ticks", "needle", "valuetext", "title"};
+    return stage >= 0 && stage < STAGE_NUM ? names[stage] : "unknown";
+}
+
+bool gipGaugeCounters::isEnabled() {
+#ifdef GIPGAUGE_ENABLE_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint64_t gipGaugeCounters::getBufferAllocationNum() {
+#ifdef GIPGAUGE_ENABLE_STATS
+    return allocationnum;
+#else
+    return 0;
+#endif
+}
+
+const gipGaugeCounters& gipGaugeCounters::getEmpty() {
+    static const gipGaugeCounters empty;
+    return empty;
+}
+
+void gipGaugeCounters::drawOverlay(gipGaugeBackend& backend, const gipGaugeCounters& counters, float x, float y) {
+    const float lineheight = 14.0f;
+    const int linenum = 3 + STAGE_NUM;
+    backend.setLayer(gipGaugeBackend::LAYER_TEXT);
+    backend.setColor(gColor(0.0f, 0.0f, 0.0f, 0.6f));
+    backend.drawRectangle(x, y, 200, linenum * lineheight + 6, true);
+    backend.setColor(gColor(1.0f, 1.0f, 1.0f, 1.0f));
+
+    double frames = counters.frames ? static_cast<double>(counters.frames) : 1.0;
+    char line[96];
+    float texty = y + lineheight;
+    if (!isEnabled()) {
+        backend.drawText("stats not compiled in", x + 4, texty, gFont::FONT_SIZE_SMALL);
+        return;
+    }
+    std::snprintf(line, sizeof(line), "frame %.3f ms (%llu frames)", counters.getFrameTimeMs(),
+                  static_cast<unsigned long long>(counters.frames));
+    backend.drawText(line, x + 4, texty, gFont::FONT_SIZE_SMALL);
+    texty += lineheight;
+    std::snprintf(line, sizeof(line), "prims %.0f  colors %.0f", counters.primitives / frames, counters.colorchanges / frames);
+    backend.drawText(line, x + 4, texty, gFont::FONT_SIZE_SMALL);
+    texty += lineheight;
+    std::snprintf(line, sizeof(line), "buf allocs %.1f  anim %.1f", counters.bufferallocations / frames, counters.animationsteps / frames);
+    backend.drawText(line, x + 4, texty, gFont::FONT_SIZE_SMALL);
+    for (int i = 0; i < STAGE_NUM; i++) {
+        texty += lineheight;
+        std::snprintf(line, sizeof(line), "%-10s %.3f ms", getStageName(i), counters.getStageTimeMs(i));
+        backend.drawText(line, x + 4, texty, gFont::FONT_SIZE_SMALL);
+    }
+}
+
+gipGaugeCountingBackend::gipGaugeCountingBackend() {
+    target = nullptr;
+    counters = nullptr;
+    hascolor = false;
+}
+
+gipGaugeCountingBackend::~gipGaugeCountingBackend() {
+}
+
+void gipGaugeCountingBackend::begin(gipGaugeBackend* newtarget, gipGaugeCounters* newcounters) {
+    target = newtarget;
+    counters = newcounters;
+    hascolor = false;
+}
+
+void gipGaugeCountingBackend::setLayer(int layer) {
+    target->setLayer(layer);
+}
+
+void gipGaugeCountingBackend::setColor(const gColor& color) {
+    if (!hascolor || color.r != lastcolor.r || color.g != lastcolor.g || color.b != lastcolor.b || color.a != lastcolor.a) {
+        counters->colorchanges++;
+        lastcolor = color;
+        hascolor = true;
+    }
+    target->setColor(color);
+}
+
+void gipGaugeCountingBackend::drawLine(float x1, float y1, float x2, float y2) {
+    counters->primitives++;
+    target->drawLine(x1, y1, x2, y2);
+}
+
+void gipGaugeCountingBackend::drawArc(float x, float y, float radius, float startAngle, float endAngle, bool filled, int segments) {
+    counters->primitives++;
+    target->drawArc(x, y, radius, startAngle, endAngle, filled, segments);
+}
+
+void gipGaugeCountingBackend::drawCircle(float x, float y, float radius, bool filled, int segments) {
+    counters->primitives++;
+    target->drawCircle(x, y, radius, filled, segments);
+}
+
+void gipGaugeCountingBackend::drawRectangle(float x, float y, float w, float h, bool filled) {
+    counters->primitives++;
+    target->drawRectangle(x, y, w, h, filled);
+}
+
+void gipGaugeCountingBackend::drawText(const std::string& text, float x, float y, int fontSize) {
+    counters->primitives++;
+    target->drawText(text, x, y, fontSize);
+}
+
+void gipGaugeCountingBackend::drawValueText(const std::string& text, float x, float y, int fontSize) {
+    counters->primitives++;
+    target->drawValueText(text, x, y, fontSize);
+}
+
+void gipGaugeCountingBackend::drawRetained(const gipGaugeDrawList& layer) {
+    // The target may replay the recording its own way, count it as recorded
+    counters->primitives += layer.getPrimitiveNum();
+    counters->colorchanges += layer.getStateChangeNum();
+    hascolor = false;
+    target->drawRetained(layer);
+}
+
+void gipGaugeCountingBackend::measureText(const std::string& text, int fontSize, float& width, float& height) {
+    target->measureText(text, fontSize, width, height);
+}
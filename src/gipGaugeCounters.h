@@ -0,0 +1,116 @@
+/*
+ * gipGaugeCounters.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGECOUNTERS_H_
+#define SRC_GIPGAUGECOUNTERS_H_
+
+#include "gipGaugeBackend.h"
+#include "gipGaugeAllocator.h"
+#include <chrono>
+#include <cstdint>
+
+// Performance counters of gauges and dashboards. They are only collected when
+// the plugin is built with GIPGAUGE_ENABLE_STATS defined, otherwise every
+// probe compiles to nothing and gauges and batches carry no counter members.
+// The flag changes class layouts, so everything including the plugin headers
+// must be built with the same setting.
+//
+// Only allocations of the plugin's frame buffers are counted, per thread, by
+// gipGaugeAllocator. Strings, std::function targets and anything else on the
+// heap are not, hence the name bufferallocations.
+struct gipGaugeCounters {
+    enum Stage {
+        STAGE_BACKGROUND = 0,
+        STAGE_ZONES,
+        STAGE_TICKS,
+        STAGE_NEEDLE,
+        STAGE_VALUETEXT,
+        STAGE_TITLE,
+        STAGE_NUM
+    };
+
+    uint64_t frames;
+    uint64_t frametime;                 // Nanoseconds in draw()
+    uint64_t stagetime[STAGE_NUM];      // Nanoseconds per stage
+    uint64_t stagecalls[STAGE_NUM];
+    uint64_t primitives;
+    uint64_t colorchanges;              // setColor calls that changed the color
+    uint64_t bufferallocations;         // Frame buffer allocations during draw()
+    uint64_t animationsteps;            // Updates that moved the displayed value
+
+    gipGaugeCounters();
+
+    void reset();
+    void add(const gipGaugeCounters& other);
+    // Per-frame averages in milliseconds
+    double getFrameTimeMs() const;
+    double getStageTimeMs(int stage) const;
+
+    static const char* getStageName(int stage);
+    static bool isEnabled();
+    // Frame buffer allocations made by the calling thread so far, 0 without
+    // the flag
+    static uint64_t getBufferAllocationNum();
+    // Zeroed counters, returned by gauges and batches built without the flag
+    static const gipGaugeCounters& getEmpty();
+
+    // Compact text block of the per-frame averages, drawn with its top left
+    // corner at x, y on a translucent panel
+    static void drawOverlay(gipGaugeBackend& backend, const gipGaugeCounters& counters, float x, float y);
+};
+
+// Times one draw stage into a counter set, compiled out without the flag
+class gipGaugeStageTimer {
+public:
+    gipGaugeStageTimer(gipGaugeCounters& counters, int stage) : counters(counters), stage(stage),
+            start(std::chrono::steady_clock::now()) {}
+    ~gipGaugeStageTimer() {
+        counters.stagetime[stage] += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count();
+        counters.stagecalls[stage]++;
+    }
+
+private:
+    gipGaugeCounters& counters;
+    int stage;
+    std::chrono::steady_clock::time_point start;
+};
+
+#ifdef GIPGAUGE_ENABLE_STATS
+#define GIPGAUGE_STAGE_TIMER(counters, stage) gipGaugeStageTimer stagetimer(counters, gipGaugeCounters::stage)
+#define GIPGAUGE_COUNT(expression) expression
+#else
+#define GIPGAUGE_STAGE_TIMER(counters, stage)
+#define GIPGAUGE_COUNT(expression)
+#endif
+
+// Forwards to another backend and counts primitives and color changes
+class gipGaugeCountingBackend : public gipGaugeBackend {
+public:
+    gipGaugeCountingBackend();
+    virtual ~gipGaugeCountingBackend();
+
+    void begin(gipGaugeBackend* target, gipGaugeCounters* counters);
+
+    void setLayer(int layer);
+    void setColor(const gColor& color);
+    void drawLine(float x1, float y1, float x2, float y2);
+    void drawArc(float x, float y, float radius, float startAngle, float endAngle, bool filled, int segments);
+    void drawCircle(float x, float y, float radius, bool filled, int segments);
+    void drawRectangle(float x, float y, float w, float h, bool filled);
+    void drawText(const std::string& text, float x, float y, int fontSize);
+    void drawValueText(const std::string& text, float x, float y, int fontSize);
+    void drawRetained(const gipGaugeDrawList& layer);
+    void measureText(const std::string& text, int fontSize, float& width, float& height);
+
+private:
+    gipGaugeBackend* target;
+    gipGaugeCounters* counters;
+    gColor lastcolor;
+    bool hascolor;
+};
+
+#endif /* SRC_GIPGAUGECOUNTERS_H_ */
@@ -0,0 +1,315 @@
+/*
+ * gipGaugeDashboard.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeDashboard.h"
+#include "gipGaugeBatch.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+static const uint32_t dashboardmagic = 0x44504947;  // "GIPD"
+static const uint32_t dashboardversion = 1;
+
+static bool parseSwitch(const std::string& token, uint8_t& out) {
+    if (token == "on" || token == "true" || token == "1") out = 1;
+    else if (token == "off" || token == "false" || token == "0") out = 0;
+    else return false;
+    return true;
+}
+
+static bool parseColor(std::istringstream& stream, float* out) {
+    if (!(stream >> out[0] >> out[1] >> out[2])) return false;
+    if (!(stream >> out[3])) out[3] = 1.0f;
+    return true;
+}
+
+static std::string readRest(std::istringstream& stream) {
+    std::string rest;
+    std::getline(stream >> std::ws, rest);
+    size_t end = rest.find_last_not_of(" \t\r");
+    return end == std::string::npos ? std::string() : rest.substr(0, end + 1);
+}
+
+static void copyName(char* out, size_t size, const std::string& text) {
+    size_t length = std::min(text.size(), size - 1);
+    std::memset(out, 0, size);
+    std::memcpy(out, text.data(), length);
+}
+
+gipGaugeDashboard::gipGaugeDashboard() {
+}
+
+gipGaugeDashboard::~gipGaugeDashboard() {
+}
+
+bool gipGaugeDashboard::fail(int line, const std::string& reason) {
+    error = line > 0 ? "line " + std::to_string(line) + ": " + reason : reason;
+    return false;
+}
+
+const std::string& gipGaugeDashboard::getError() const {
+    return error;
+}
+
+bool gipGaugeDashboard::loadText(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) return fail(0, "cannot open " + path);
+    std::stringstream text;
+    text << file.rdbuf();
+    return parseText(text.str());
+}
+
+bool gipGaugeDashboard::parseText(const std::string& text) {
+    gipGauge defaults;
+    gipGauge::Config defaultconfig;
+    defaults.getConfig(defaultconfig);
+
+    std::vector<Entry> newentries;
+    std::vector<gipGauge::ZoneConfig> newzones;
+    Entry* entry = nullptr;
+
+    std::istringstream lines(text);
+    std::string line;
+    int linenum = 0;
+    while (std::getline(lines, line)) {
+        linenum++;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+        std::istringstream stream(line);
+        std::string keyword;
+        if (!(stream >> keyword)) continue;
+
+        if (keyword == "gauge") {
+            if (entry) return fail(linenum, "missing end");
+            newentries.emplace_back();
+            entry = &newentries.back();
+            std::memset(entry, 0, sizeof(Entry));
+            copyName(entry->name, sizeof(entry->name), readRest(stream));
+            entry->w = entry->h = 100;
+            entry->zoneoffset = newzones.size();
+            entry->config = defaultconfig;
+            continue;
+        }
+        if (entry == nullptr) return fail(linenum, "'" + keyword + "' outside of a gauge");
+        gipGauge::Config& config = entry->config;
+
+        bool valid = true;
+        if (keyword == "end") {
+            entry->zonenum = newzones.size() - entry->zoneoffset;
+            entry = nullptr;
+        } else if (keyword == "rect") {
+            valid = static_cast<bool>(stream >> entry->x >> entry->y >> entry->w >> entry->h);
+        } else if (keyword == "type") {
+            std::string type;
+            stream >> type;
+            if (type == "circular") config.type = gipGauge::GAUGE_CIRCULAR;
+            else if (type == "semicircle") config.type = gipGauge::GAUGE_SEMICIRCLE;
+            else if (type == "horizontal") config.type = gipGauge::GAUGE_LINEAR_HORIZONTAL;
+            else if (type == "vertical") config.type = gipGauge::GAUGE_LINEAR_VERTICAL;
+            else valid = false;
+        } else if (keyword == "style") {
+            std::string style;
+            stream >> style;
+            if (style == "modern") config.style = gipGauge::STYLE_MODERN;
+            else if (style == "classic") config.style = gipGauge::STYLE_CLASSIC;
+            else if (style == "digital") config.style = gipGauge::STYLE_DIGITAL;
+            else if (style == "minimalist") config.style = gipGauge::STYLE_MINIMALIST;
+            else valid = false;
+        } else if (keyword == "range") {
+            valid = static_cast<bool>(stream >> config.minValue >> config.maxValue);
+        } else if (keyword == "precision") {
+            valid = static_cast<bool>(stream >> config.valuePrecision);
+        } else if (keyword == "title") {
+            copyName(config.title, sizeof(config.title), readRest(stream));
+        } else if (keyword == "unit") {
+            copyName(config.unit, sizeof(config.unit), readRest(stream));
+        } else if (keyword == "ticks") {
+            valid = static_cast<bool>(stream >> config.majorTicks >> config.minorTicks);
+        } else if (keyword == "show") {
+            std::string element, state;
+            stream >> element >> state;
+            uint8_t* target = nullptr;
+            if (element == "value") target = &config.showValue;
+            else if (element == "title") target = &config.showTitle;
+            else if (element == "needle") target = &config.showNeedle;
+            else if (element == "ticklabels") target = &config.showTickLabels;
+            else if (element == "sparkline") target = &config.showSparkline;
+            else if (element == "peaks") target = &config.showPeakMarkers;
+            valid = target && parseSwitch(state, *target);
+        } else if (keyword == "color") {
+            std::string element;
+            stream >> element;
+            float* target = nullptr;
+            if (element == "background") target = config.backgroundColor;
+            else if (element == "needle") target = config.needleColor;
+            else if (element == "tick") target = config.tickColor;
+            else if (element == "valuetext") target = config.valueTextColor;
+            else if (element == "title") target = config.titleColor;
+            else if (element == "danger") target = config.dangerZoneColor;
+            else if (element == "warning") target = config.warningZoneColor;
+            else if (element == "safe") target = config.safeZoneColor;
+            valid = target && parseColor(stream, target);
+        } else if (keyword == "zone") {
+            std::string first;
+            stream >> first;
+            float* range = nullptr;
+            uint8_t* enabled = nullptr;
+            if (first == "danger") {
+                range = config.dangerZone;
+                enabled = &config.dangerZoneEnabled;
+            } else if (first == "warning") {
+                range = config.warningZone;
+                enabled = &config.warningZoneEnabled;
+            } else if (first == "safe") {
+                range = config.safeZone;
+                enabled = &config.safeZoneEnabled;
+            }
+            if (range) {
+                valid = static_cast<bool>(stream >> range[0] >> range[1]);
+                *enabled = 1;
+            } else {
+                gipGauge::ZoneConfig zone;
+                std::istringstream start(first);
+                valid = static_cast<bool>(start >> zone.startValue) && static_cast<bool>(stream >> zone.endValue) &&
+                        parseColor(stream, zone.color);
+                if (valid) newzones.push_back(zone);
+            }
+        } else if (keyword == "animation") {
+            std::string state;
+            stream >> state;
+            valid = parseSwitch(state, config.animationEnabled);
+            float speed;
+            if (stream >> speed) config.animationSpeed = speed;
+        } else if (keyword == "needle") {
+            valid = static_cast<bool>(stream >> config.needleLength >> config.needleWidth);
+        } else if (keyword == "retained") {
+            std::string state;
+            stream >> state;
+            valid = parseSwitch(state, config.retainedMode);
+        } else if (keyword == "lod") {
+            std::string state;
+            stream >> state;
+            valid = parseSwitch(state, config.lodEnabled);
+        } else {
+            return fail(linenum, "unknown keyword '" + keyword + "'");
+        }
+        if (!valid) return fail(linenum, "invalid '" + keyword + "' statement");
+    }
+    if (entry) return fail(linenum, "missing end");
+
+    entries.swap(newentries);
+    zones.swap(newzones);
+    error.clear();
+    return true;
+}
+
+bool gipGaugeDashboard::saveBinary(const std::string& path) const {
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) return false;
+    uint32_t header[6] = {
+        dashboardmagic, dashboardversion,
+        static_cast<uint32_t>(sizeof(Entry)), static_cast<uint32_t>(sizeof(gipGauge::ZoneConfig)),
+        static_cast<uint32_t>(entries.size()), static_cast<uint32_t>(zones.size())
+    };
+    bool written = std::fwrite(header, sizeof(header), 1, file) == 1 &&
+                   std::fwrite(entries.data(), sizeof(Entry), entries.size(), file) == entries.size() &&
+                   std::fwrite(zones.data(), sizeof(gipGauge::ZoneConfig), zones.size(), file) == zones.size();
+    return std::fclose(file) == 0 && written;
+}
+
+bool gipGaugeDashboard::loadBinary(const std::string& path) {
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) return fail(0, "cannot open " + path);
+
+    // Records are stored exactly as laid out in memory, two bulk reads fill them
+    uint32_t header[6];
+    if (std::fread(header, sizeof(header), 1, file) != 1 || header[0] != dashboardmagic ||
+        header[1] != dashboardversion || header[2] != sizeof(Entry) || header[3] != sizeof(gipGauge::ZoneConfig)) {
+        std::fclose(file);
+        return fail(0, "not a compiled dashboard of this version");
+    }
+    // The counts come from the file, they have to describe exactly its size
+    // before anything is allocated from them
+    long filesize = -1;
+    if (std::fseek(file, 0, SEEK_END) == 0) filesize = std::ftell(file);
+    uint64_t expected = sizeof(header) + static_cast<uint64_t>(header[4]) * sizeof(Entry) +
+                        static_cast<uint64_t>(header[5]) * sizeof(gipGauge::ZoneConfig);
+    if (filesize < 0 || static_cast<uint64_t>(filesize) != expected || std::fseek(file, sizeof(header), SEEK_SET) != 0) {
+        std::fclose(file);
+        return fail(0, "truncated or corrupt dashboard");
+    }
+    std::vector<Entry> newentries(header[4]);
+    std::vector<gipGauge::ZoneConfig> newzones(header[5]);
+    bool valid = std::fread(newentries.data(), sizeof(Entry), newentries.size(), file) == newentries.size() &&
+                 std::fread(newzones.data(), sizeof(gipGauge::ZoneConfig), newzones.size(), file) == newzones.size();
+    std::fclose(file);
+    for (size_t i = 0; valid && i < newentries.size(); i++) {
+        valid = static_cast<uint64_t>(newentries[i].zoneoffset) + newentries[i].zonenum <= newzones.size();
+    }
+    if (!valid) return fail(0, "truncated or corrupt dashboard");
+
+    entries.swap(newentries);
+    zones.swap(newzones);
+    error.clear();
+    return true;
+}
+
+void gipGaugeDashboard::clear() {
+    entries.clear();
+    zones.clear();
+}
+
+int gipGaugeDashboard::addGauge(const std::string& name, const gipGauge& gauge, int x, int y, int w, int h) {
+    Entry entry;
+    std::memset(&entry, 0, sizeof(Entry));
+    copyName(entry.name, sizeof(entry.name), name);
+    entry.x = x;
+    entry.y = y;
+    entry.w = w;
+    entry.h = h;
+    gauge.getConfig(entry.config);
+
+    std::vector<gipGauge::ZoneConfig> gaugezones;
+    gauge.getZoneConfigs(gaugezones);
+    entry.zoneoffset = zones.size();
+    entry.zonenum = gaugezones.size();
+    zones.insert(zones.end(), gaugezones.begin(), gaugezones.end());
+    entries.push_back(entry);
+    return entries.size() - 1;
+}
+
+int gipGaugeDashboard::getGaugeNum() const {
+    return entries.size();
+}
+
+const gipGaugeDashboard::Entry& gipGaugeDashboard::getEntry(int index) const {
+    return entries[index];
+}
+
+int gipGaugeDashboard::findGauge(const std::string& name) const {
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (std::strncmp(entries[i].name, name.c_str(), sizeof(entries[i].name)) == 0) return i;
+    }
+    return -1;
+}
+
+void gipGaugeDashboard::apply(int index, gipGauge& gauge) const {
+    const Entry& entry = entries[index];
+    gauge.applyConfig(entry.config);
+    gauge.setZoneConfigs(zones.data() + entry.zoneoffset, entry.zonenum);
+}
+
+void gipGaugeDashboard::build(std::vector<std::unique_ptr<gipGauge>>& gauges, gipGaugeBatch* batch) const {
+    if (batch) batch->clear();
+    gauges.resize(entries.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (!gauges[i]) gauges[i].reset(new gipGauge());
+        apply(i, *gauges[i]);
+        const Entry& entry = entries[i];
+        if (batch) batch->addGauge(gauges[i].get(), entry.x, entry.y, entry.w, entry.h);
+    }
+}
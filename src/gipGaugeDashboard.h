@@ -0,0 +1,81 @@
+/*
+ * gipGaugeDashboard.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGEDASHBOARD_H_
+#define SRC_GIPGAUGEDASHBOARD_H_
+
+#include "gipGauge.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+class gipGaugeBatch;
+
+// Dashboard definition: one configuration record, rect and zone list per
+// gauge. Authored as text, compiled to a binary file that loads with a few
+// bulk reads and no per-field parsing.
+//
+// Text format, one statement per line, '#' starts a comment:
+//   gauge <name>
+//   rect <x> <y> <w> <h>
+//   type circular|semicircle|horizontal|vertical
+//   style modern|classic|digital|minimalist
+//   range <min> <max>
+//   precision <digits>
+//   title <text>
+//   unit <text>
+//   ticks <major> <minor>
+//   show value|title|needle|ticklabels|sparkline|peaks on|off
+//   color background|needle|tick|valuetext|title|danger|warning|safe <r> <g> <b> [a]
+//   zone danger|warning|safe <start> <end>
+//   zone <start> <end> <r> <g> <b> [a]
+//   animation on|off [speed]
+//   needle <length> <width>
+//   retained on|off
+//   lod on|off
+//   end
+class gipGaugeDashboard {
+public:
+    struct Entry {
+        char name[32];
+        int32_t x, y, w, h;
+        uint32_t zoneoffset;
+        uint32_t zonenum;
+        gipGauge::Config config;
+    };
+
+    gipGaugeDashboard();
+    virtual ~gipGaugeDashboard();
+
+    bool loadText(const std::string& path);
+    bool parseText(const std::string& text);
+    bool saveBinary(const std::string& path) const;
+    bool loadBinary(const std::string& path);
+    // Line and reason of the last failed load
+    const std::string& getError() const;
+
+    void clear();
+    // Adds the current configuration of a gauge, returns its index
+    int addGauge(const std::string& name, const gipGauge& gauge, int x, int y, int w, int h);
+    int getGaugeNum() const;
+    const Entry& getEntry(int index) const;
+    int findGauge(const std::string& name) const;
+
+    // Configures one gauge, its values, history and statistics stay
+    void apply(int index, gipGauge& gauge) const;
+    // One gauge per entry. Existing gauges are reused in order, so reloading a
+    // definition keeps their runtime state. The batch, if any, is refilled.
+    void build(std::vector<std::unique_ptr<gipGauge>>& gauges, gipGaugeBatch* batch = nullptr) const;
+
+private:
+    std::vector<Entry> entries;
+    std::vector<gipGauge::ZoneConfig> zones;
+    std::string error;
+
+    bool fail(int line, const std::string& reason);
+};
+
+#endif /* SRC_GIPGAUGEDASHBOARD_H_ */
@@ -0,0 +1,222 @@
+/*
+ * gipGaugeDrawList.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeDrawList.h"
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+
+gipGaugeDrawList::gipGaugeDrawList() {
+    clear();
+}
+
+gipGaugeDrawList::~gipGaugeDrawList() {
+}
+
+void gipGaugeDrawList::clear() {
+    commands.clear();
+    colors.clear();
+    texts.clear();
+    for (int i = 0; i < COMMAND_TYPE_NUM; i++) commandcounts[i] = 0;
+    currentlayer = LAYER_BACKGROUND;
+    currentcolor = -1;
+    statechanges = 0;
+}
+
+void gipGaugeDrawList::replay(gipGaugeBackend& target) const {
+    for (const Command& command : commands) {
+        switch(command.type) {
+            case COMMAND_LAYER:
+                target.setLayer(command.layer);
+                break;
+            case COMMAND_COLOR:
+                target.setColor(colors[command.arg0]);
+                break;
+            case COMMAND_LINE:
+                target.drawLine(command.p[0], command.p[1], command.p[2], command.p[3]);
+                break;
+            case COMMAND_ARC:
+                target.drawArc(command.p[0], command.p[1], command.p[2], command.p[3], command.p[4], command.filled, command.arg0);
+                break;
+            case COMMAND_CIRCLE:
+                target.drawCircle(command.p[0], command.p[1], command.p[2], command.filled, command.arg0);
+                break;
+            case COMMAND_RECTANGLE:
+                target.drawRectangle(command.p[0], command.p[1], command.p[2], command.p[3], command.filled);
+                break;
+            case COMMAND_TEXT:
+                if (command.filled) target.drawValueText(texts[command.arg0], command.p[0], command.p[1], command.arg1);
+                else target.drawText(texts[command.arg0], command.p[0], command.p[1], command.arg1);
+                break;
+        }
+    }
+}
+
+gipGaugeDrawList::Command& gipGaugeDrawList::addCommand(CommandType type) {
+    Command command;
+    std::memset(&command, 0, sizeof(command));
+    command.type = type;
+    command.layer = currentlayer;
+    commands.push_back(command);
+    commandcounts[type]++;
+    return commands.back();
+}
+
+int gipGaugeDrawList::findColor(const gColor& color) {
+    for (size_t i = 0; i < colors.size(); i++) {
+        const gColor& c = colors[i];
+        if (c.r == color.r && c.g == color.g && c.b == color.b && c.a == color.a) return i;
+    }
+    colors.push_back(color);
+    return colors.size() - 1;
+}
+
+void gipGaugeDrawList::setLayer(int layer) {
+    currentlayer = layer;
+    addCommand(COMMAND_LAYER);
+}
+
+void gipGaugeDrawList::setColor(const gColor& color) {
+    int index = findColor(color);
+    if (index != currentcolor) statechanges++;
+    currentcolor = index;
+    addCommand(COMMAND_COLOR).arg0 = index;
+}
+
+void gipGaugeDrawList::drawLine(float x1, float y1, float x2, float y2) {
+    Command& command = addCommand(COMMAND_LINE);
+    command.p[0] = x1;
+    command.p[1] = y1;
+    command.p[2] = x2;
+    command.p[3] = y2;
+}
+
+void gipGaugeDrawList::drawArc(float x, float y, float radius, float startAngle, float endAngle, bool filled, int segments) {
+    Command& command = addCommand(COMMAND_ARC);
+    command.filled = filled;
+    command.arg0 = segments;
+    command.p[0] = x;
+    command.p[1] = y;
+    command.p[2] = radius;
+    command.p[3] = startAngle;
+    command.p[4] = endAngle;
+}
+
+void gipGaugeDrawList::drawCircle(float x, float y, float radius, bool filled, int segments) {
+    Command& command = addCommand(COMMAND_CIRCLE);
+    command.filled = filled;
+    command.arg0 = segments;
+    command.p[0] = x;
+    command.p[1] = y;
+    command.p[2] = radius;
+}
+
+void gipGaugeDrawList::drawRectangle(float x, float y, float w, float h, bool filled) {
+    Command& command = addCommand(COMMAND_RECTANGLE);
+    command.filled = filled;
+    command.p[0] = x;
+    command.p[1] = y;
+    command.p[2] = w;
+    command.p[3] = h;
+}
+
+void gipGaugeDrawList::drawText(const std::string& text, float x, float y, int fontSize) {
+    texts.push_back(text);
+    Command& command = addCommand(COMMAND_TEXT);
+    command.arg0 = texts.size() - 1;
+    command.arg1 = fontSize;
+    command.p[0] = x;
+    command.p[1] = y;
+}
+
+void gipGaugeDrawList::drawValueText(const std::string& text, float x, float y, int fontSize) {
+    drawText(text, x, y, fontSize);
+    commands.back().filled = true;
+}
+
+const gipGaugeVector<gipGaugeDrawList::Command>& gipGaugeDrawList::getCommands() const {
+    return commands;
+}
+
+const gColor& gipGaugeDrawList::getColor(int index) const {
+    return colors[index];
+}
+
+const std::string& gipGaugeDrawList::getText(int index) const {
+    return texts[index];
+}
+
+int gipGaugeDrawList::getCommandNum() const {
+    return commands.size();
+}
+
+int gipGaugeDrawList::getCommandNum(CommandType type) const {
+    return commandcounts[type];
+}
+
+int gipGaugeDrawList::getPrimitiveNum() const {
+    return commands.size() - commandcounts[COMMAND_LAYER] - commandcounts[COMMAND_COLOR];
+}
+
+int gipGaugeDrawList::getStateChangeNum() const {
+    return statechanges;
+}
+
+uint64_t gipGaugeDrawList::getChecksum() const {
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&hash](const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+    };
+    for (const Command& command : commands) {
+        // Hash field by field, the struct has no padding but stay explicit
+        mix(&command.type, 4);
+        mix(&command.arg0, sizeof(command.arg0));
+        mix(&command.arg1, sizeof(command.arg1));
+        mix(command.p, sizeof(command.p));
+    }
+    for (const gColor& color : colors) {
+        float rgba[4] = {color.r, color.g, color.b, color.a};
+        mix(rgba, sizeof(rgba));
+    }
+    for (const std::string& text : texts) {
+        mix(text.data(), text.size() + 1);
+    }
+    return hash;
+}
+
+std::string gipGaugeDrawList::toString() const {
+    static const char* names[COMMAND_TYPE_NUM] = {"layer", "color", "line", "arc", "circle", "rect", "text"};
+    std::string out;
+    char line[160];
+    for (const Command& command : commands) {
+        int length = 0;
+        switch(command.type) {
+            case COMMAND_LAYER:
+                length = std::snprintf(line, sizeof(line), "%s %d\n", names[command.type], command.layer);
+                break;
+            case COMMAND_COLOR: {
+                const gColor& c = colors[command.arg0];
+                length = std::snprintf(line, sizeof(line), "%s %.3f %.3f %.3f %.3f\n", names[command.type], c.r, c.g, c.b, c.a);
+                break;
+            }
+            case COMMAND_TEXT:
+                length = std::snprintf(line, sizeof(line), "%s %.2f %.2f %d \"%s\"\n", names[command.type],
+                                       command.p[0], command.p[1], command.arg1, texts[command.arg0].c_str());
+                break;
+            default:
+                length = std::snprintf(line, sizeof(line), "%s %.2f %.2f %.2f %.2f %.2f %d %d\n", names[command.type],
+                                       command.p[0], command.p[1], command.p[2], command.p[3], command.p[4],
+                                       command.filled, command.arg0);
+                break;
+        }
+        out.append(line, std::min<int>(length, sizeof(line) - 1));
+    }
+    return out;
+}
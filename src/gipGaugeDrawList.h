@@ -0,0 +1,86 @@
+/*
+ * gipGaugeDrawList.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGEDRAWLIST_H_
+#define SRC_GIPGAUGEDRAWLIST_H_
+
+#include "gipGaugeBackend.h"
+#include "gipGaugeAllocator.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+// Headless backend recording every primitive into a compact in-memory list.
+// Useful for counting primitives and state changes, diffing output between
+// versions without a GL context, and replaying the frame to another backend.
+class gipGaugeDrawList : public gipGaugeBackend {
+public:
+    enum CommandType {
+        COMMAND_LAYER = 0,
+        COMMAND_COLOR,
+        COMMAND_LINE,
+        COMMAND_ARC,
+        COMMAND_CIRCLE,
+        COMMAND_RECTANGLE,
+        COMMAND_TEXT,
+        COMMAND_TYPE_NUM
+    };
+
+    struct Command {
+        uint8_t type;
+        uint8_t layer;
+        uint8_t filled;     // Dynamic text for COMMAND_TEXT
+        uint8_t reserved;
+        int32_t arg0;   // Color index, segment count or text index
+        int32_t arg1;   // Font size for text
+        float p[5];
+    };
+
+    gipGaugeDrawList();
+    virtual ~gipGaugeDrawList();
+
+    void clear();
+    void replay(gipGaugeBackend& target) const;
+
+    void setLayer(int layer);
+    void setColor(const gColor& color);
+    void drawLine(float x1, float y1, float x2, float y2);
+    void drawArc(float x, float y, float radius, float startAngle, float endAngle, bool filled, int segments);
+    void drawCircle(float x, float y, float radius, bool filled, int segments);
+    void drawRectangle(float x, float y, float w, float h, bool filled);
+    void drawText(const std::string& text, float x, float y, int fontSize);
+    void drawValueText(const std::string& text, float x, float y, int fontSize);
+
+    const gipGaugeVector<Command>& getCommands() const;
+    const gColor& getColor(int index) const;
+    const std::string& getText(int index) const;
+
+    int getCommandNum() const;
+    int getCommandNum(CommandType type) const;
+    // Line, arc, circle, rectangle and text commands
+    int getPrimitiveNum() const;
+    // setColor calls that actually changed the color
+    int getStateChangeNum() const;
+
+    // Stable FNV-1a hash of the recorded output for regression checks
+    uint64_t getChecksum() const;
+    // One command per line, for diffing recordings
+    std::string toString() const;
+
+private:
+    gipGaugeVector<Command> commands;
+    gipGaugeVector<gColor> colors;
+    gipGaugeVector<std::string> texts;
+    int commandcounts[COMMAND_TYPE_NUM];
+    int currentlayer;
+    int currentcolor;
+    int statechanges;
+
+    Command& addCommand(CommandType type);
+    int findColor(const gColor& color);
+};
+
+#endif /* SRC_GIPGAUGEDRAWLIST_H_ */
@@ -0,0 +1,97 @@
+/*
+ * gipGaugeGeometry.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGEGEOMETRY_H_
+#define SRC_GIPGAUGEGEOMETRY_H_
+
+#include <algorithm>
+
+// Compile-time geometry of each gauge type. A policy fixes the sweep, the
+// center and radius inside the drawing rect and where the overlays sit, so
+// code instantiated with it has no per-call type branches and the angle
+// mapping folds to a single multiply-add.
+//
+// Arc policies: ARC is true, angles in degrees, clockwise from +x on screen.
+// Linear policies: ARC is false, HORIZONTAL picks the fill direction.
+
+// 3/4 circle, 225° to 495°, starting from bottom-left
+struct gipGaugeCircularPolicy {
+    static constexpr bool ARC = true;
+    static constexpr bool HORIZONTAL = false;
+    static constexpr float START_ANGLE = 225.0f;
+    static constexpr float SWEEP_ANGLE = 270.0f;
+    // The dial background is a full disc rather than the swept arc
+    static constexpr bool FULL_DIAL = true;
+
+    // Overlays, relative to the center in units of the radius or pixels
+    static constexpr float SPARKLINE_Y = 0.3f;
+    static constexpr float SPARKLINE_H = 0.3f;
+    static constexpr float VALUE_TEXT_Y = 10.0f;
+
+    static void layout(int x, int y, int w, int h, float& centerX, float& centerY, float& radius) {
+        centerX = x + w * 0.5f;
+        centerY = y + h * 0.5f;
+        radius = std::min(w, h) * 0.4f;
+    }
+};
+
+// Bottom-anchored half circle, 180° to 360°
+struct gipGaugeSemicirclePolicy {
+    static constexpr bool ARC = true;
+    static constexpr bool HORIZONTAL = false;
+    static constexpr float START_ANGLE = 180.0f;
+    static constexpr float SWEEP_ANGLE = 180.0f;
+    static constexpr bool FULL_DIAL = false;
+
+    static constexpr float SPARKLINE_Y = -0.6f;
+    static constexpr float SPARKLINE_H = 0.25f;
+    static constexpr float VALUE_TEXT_Y = -20.0f;
+
+    static void layout(int x, int y, int w, int h, float& centerX, float& centerY, float& radius) {
+        centerX = x + w * 0.5f;
+        centerY = y + h * 0.8f;
+        radius = std::min(static_cast<float>(w), h * 1.25f) * 0.4f;
+    }
+};
+
+// Bar filling left to right
+struct gipGaugeLinearHorizontalPolicy {
+    static constexpr bool ARC = false;
+    static constexpr bool HORIZONTAL = true;
+};
+
+// Bar filling bottom to top
+struct gipGaugeLinearVerticalPolicy {
+    static constexpr bool ARC = false;
+    static constexpr bool HORIZONTAL = false;
+};
+
+// Value mapping for one policy. Ratios are clamped to [0, 1].
+template<typename Policy>
+struct gipGaugeGeometry {
+    static float valueToRatio(float value, float minValue, float maxValue) {
+        float ratio = (value - minValue) / (maxValue - minValue);
+        return std::max(0.0f, std::min(1.0f, ratio));
+    }
+
+    static float ratioToAngle(float ratio) {
+        static_assert(Policy::ARC, "angles are defined for arc gauges only");
+        return Policy::START_ANGLE + ratio * Policy::SWEEP_ANGLE;
+    }
+
+    static float valueToAngle(float value, float minValue, float maxValue) {
+        return ratioToAngle(valueToRatio(value, minValue, maxValue));
+    }
+
+    static float angleToValue(float angle, float minValue, float maxValue) {
+        static_assert(Policy::ARC, "angles are defined for arc gauges only");
+        float ratio = (angle - Policy::START_ANGLE) / Policy::SWEEP_ANGLE;
+        ratio = std::max(0.0f, std::min(1.0f, ratio));
+        return minValue + ratio * (maxValue - minValue);
+    }
+};
+
+#endif /* SRC_GIPGAUGEGEOMETRY_H_ */
@@ -0,0 +1,247 @@
+/*
+ * gipGaugeHistory.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeHistory.h"
+#include "gipGaugeBinary.h"
+#include <algorithm>
+
+gipGaugeHistory::gipGaugeHistory() {
+    capacity = 0;
+    mask = 0;
+    count = 0;
+}
+
+gipGaugeHistory::~gipGaugeHistory() {
+}
+
+void gipGaugeHistory::allocate(int newcapacity, int levelNum) {
+    int size = 0;
+    if (newcapacity > 0) {
+        size = 1;
+        while (size < newcapacity) size <<= 1;
+    }
+    capacity = size;
+    mask = size > 0 ? size - 1 : 0;
+    samples.assign(size, 0.0f);
+
+    // Level 0 is the raw sample ring, its Level entry stays empty
+    levelNum = std::max(1, std::min(static_cast<int>(MAX_LEVELS), levelNum));
+    levels.assign(size > 0 ? levelNum : 0, Level());
+    for (size_t l = 1; l < levels.size(); l++) {
+        levels[l].mins.assign(size, 0.0f);
+        levels[l].maxs.assign(size, 0.0f);
+    }
+    clear();
+}
+
+void gipGaugeHistory::clear() {
+    count = 0;
+    for (Level& level : levels) {
+        level.committed = 0;
+        level.partialcount = 0;
+        level.partialmin = level.partialmax = 0.0f;
+    }
+}
+
+bool gipGaugeHistory::isAllocated() const {
+    return capacity > 0;
+}
+
+void gipGaugeHistory::push(float value) {
+    if (capacity == 0) return;
+    samples[count & mask] = value;
+    count++;
+
+    // Fold into the open bucket of each level, carrying completed buckets up
+    float minValue = value;
+    float maxValue = value;
+    for (size_t l = 1; l < levels.size(); l++) {
+        Level& level = levels[l];
+        if (level.partialcount == 0) {
+            level.partialmin = minValue;
+            level.partialmax = maxValue;
+        } else {
+            level.partialmin = std::min(level.partialmin, minValue);
+            level.partialmax = std::max(level.partialmax, maxValue);
+        }
+        if (++level.partialcount < BUCKET_FACTOR) break;
+
+        int64_t slot = level.committed & mask;
+        level.mins[slot] = level.partialmin;
+        level.maxs[slot] = level.partialmax;
+        level.committed++;
+        level.partialcount = 0;
+        minValue = level.partialmin;
+        maxValue = level.partialmax;
+    }
+}
+
+int gipGaugeHistory::getCapacity() const {
+    return capacity;
+}
+
+int gipGaugeHistory::getLevelNum() const {
+    return levels.size();
+}
+
+int64_t gipGaugeHistory::getSampleNum() const {
+    return count;
+}
+
+int64_t gipGaugeHistory::getSpan() const {
+    if (levels.empty()) return 0;
+    return capacity * getBucketSize(levels.size() - 1);
+}
+
+size_t gipGaugeHistory::getMemorySize() const {
+    size_t size = samples.capacity() * sizeof(float);
+    for (const Level& level : levels) {
+        size += (level.mins.capacity() + level.maxs.capacity()) * sizeof(float);
+    }
+    return size;
+}
+
+float gipGaugeHistory::getLast() const {
+    return count > 0 ? samples[(count - 1) & mask] : 0.0f;
+}
+
+int64_t gipGaugeHistory::getBucketSize(int level) const {
+    int64_t size = 1;
+    for (int l = 0; l < level; l++) size *= BUCKET_FACTOR;
+    return size;
+}
+
+void gipGaugeHistory::readBucket(int level, int64_t bucket, float& minValue, float& maxValue) const {
+    if (level == 0) {
+        minValue = maxValue = samples[bucket & mask];
+        return;
+    }
+    const Level& entry = levels[level];
+    if (bucket < entry.committed) {
+        minValue = entry.mins[bucket & mask];
+        maxValue = entry.maxs[bucket & mask];
+        return;
+    }
+
+    // The open bucket is the union of the open buckets of this level and below.
+    // An empty open bucket holds no samples, it reads as the newest one.
+    minValue = maxValue = getLast();
+    bool found = false;
+    for (int l = level; l >= 1; l--) {
+        const Level& open = levels[l];
+        if (open.partialcount == 0) continue;
+        if (!found) {
+            minValue = open.partialmin;
+            maxValue = open.partialmax;
+            found = true;
+        } else {
+            minValue = std::min(minValue, open.partialmin);
+            maxValue = std::max(maxValue, open.partialmax);
+        }
+    }
+}
+
+int gipGaugeHistory::decimate(int64_t sampleNum, int columns, float* outMin, float* outMax) const {
+    if (count == 0 || columns <= 0 || sampleNum <= 0) return 0;
+
+    // Oldest sample still reachable at a level
+    int lastlevel = levels.size() - 1;
+    auto getOldest = [&](int level) -> int64_t {
+        if (level == 0) return std::max<int64_t>(0, count - capacity);
+        return std::max<int64_t>(0, levels[level].committed - capacity) * getBucketSize(level);
+    };
+
+    sampleNum = std::min(sampleNum, count - getOldest(lastlevel));
+    columns = static_cast<int>(std::min<int64_t>(columns, sampleNum));
+    int64_t start = count - sampleNum;
+
+    // Coarsest level whose buckets still fit in a column, or whichever level
+    // first reaches back far enough. When even the coarsest level is finer
+    // than a column, each column walks several buckets, but no bucket is
+    // read twice, so the walk stays within capacity + columns reads.
+    double samplesPerColumn = static_cast<double>(sampleNum) / columns;
+    int level = 0;
+    while (level < lastlevel &&
+           (getBucketSize(level + 1) <= samplesPerColumn || getOldest(level) > start)) {
+        level++;
+    }
+
+    int64_t bucketSize = getBucketSize(level);
+    int64_t firstBucket = getOldest(level) / bucketSize;
+    for (int c = 0; c < columns; c++) {
+        int64_t s0 = start + sampleNum * c / columns;
+        int64_t s1 = start + sampleNum * (c + 1) / columns;
+        int64_t b0 = std::max(firstBucket, s0 / bucketSize);
+        int64_t b1 = (s1 - 1) / bucketSize;
+
+        float minValue = 0.0f, maxValue = 0.0f;
+        readBucket(level, b0, minValue, maxValue);
+        for (int64_t b = b0 + 1; b <= b1; b++) {
+            float bucketMin = 0.0f, bucketMax = 0.0f;
+            readBucket(level, b, bucketMin, bucketMax);
+            minValue = std::min(minValue, bucketMin);
+            maxValue = std::max(maxValue, bucketMax);
+        }
+        outMin[c] = minValue;
+        outMax[c] = maxValue;
+    }
+    return columns;
+}
+
+void gipGaugeHistory::save(std::vector<uint8_t>& out) const {
+    gipGaugeBinary::append(out, static_cast<int32_t>(capacity));
+    gipGaugeBinary::append(out, static_cast<int32_t>(levels.size()));
+    gipGaugeBinary::append(out, count);
+    gipGaugeBinary::appendVector(out, samples);
+    for (size_t l = 1; l < levels.size(); l++) {
+        const Level& level = levels[l];
+        gipGaugeBinary::append(out, level.committed);
+        gipGaugeBinary::append(out, level.partialmin);
+        gipGaugeBinary::append(out, level.partialmax);
+        gipGaugeBinary::append(out, static_cast<int32_t>(level.partialcount));
+        gipGaugeBinary::appendVector(out, level.mins);
+        gipGaugeBinary::appendVector(out, level.maxs);
+    }
+}
+
+bool gipGaugeHistory::load(const uint8_t*& cursor, const uint8_t* end) {
+    // Everything is parsed into a temporary first, the sizes are bounded by
+    // the bytes left, and this history only changes once all of it is valid
+    const uint8_t* start = cursor;
+    int32_t newcapacity, levelNum;
+    gipGaugeHistory loaded;
+    bool valid = gipGaugeBinary::read(cursor, end, newcapacity) && gipGaugeBinary::read(cursor, end, levelNum) &&
+                 newcapacity >= 0 && (newcapacity & (newcapacity - 1)) == 0 &&
+                 levelNum >= (newcapacity > 0 ? 1 : 0) && levelNum <= (newcapacity > 0 ? MAX_LEVELS : 0) &&
+                 gipGaugeBinary::read(cursor, end, loaded.count) && loaded.count >= 0 &&
+                 gipGaugeBinary::readVector(cursor, end, loaded.samples) &&
+                 static_cast<int>(loaded.samples.size()) == newcapacity;
+    if (valid) loaded.levels.resize(levelNum);
+    for (size_t l = 1; valid && l < loaded.levels.size(); l++) {
+        Level& level = loaded.levels[l];
+        int32_t partialcount = 0;
+        valid = gipGaugeBinary::read(cursor, end, level.committed) &&
+                gipGaugeBinary::read(cursor, end, level.partialmin) &&
+                gipGaugeBinary::read(cursor, end, level.partialmax) &&
+                gipGaugeBinary::read(cursor, end, partialcount) &&
+                gipGaugeBinary::readVector(cursor, end, level.mins) &&
+                gipGaugeBinary::readVector(cursor, end, level.maxs) &&
+                static_cast<int>(level.mins.size()) == newcapacity &&
+                static_cast<int>(level.maxs.size()) == newcapacity;
+        level.partialcount = partialcount;
+    }
+    if (!valid) {
+        cursor = start;
+        return false;
+    }
+
+    samples.swap(loaded.samples);
+    levels.swap(loaded.levels);
+    capacity = newcapacity;
+    mask = newcapacity > 0 ? newcapacity - 1 : 0;
+    count = loaded.count;
+    return true;
+}
@@ -0,0 +1,75 @@
+/*
+ * gipGaugeHistory.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGEHISTORY_H_
+#define SRC_GIPGAUGEHISTORY_H_
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Fixed-memory value history. Level 0 keeps the newest raw samples, and every
+// further level keeps the same number of min/max buckets, each covering
+// BUCKET_FACTOR buckets of the level below. Recent history is exact, older
+// history gets coarser, and memory never grows after allocate().
+class gipGaugeHistory {
+public:
+    static const int BUCKET_FACTOR = 8;
+    static const int MAX_LEVELS = 8;
+
+    gipGaugeHistory();
+    virtual ~gipGaugeHistory();
+
+    // Capacity is rounded up to a power of two and applies to every level,
+    // a capacity of 0 releases the buffers
+    void allocate(int capacity, int levels = 4);
+    void clear();
+    bool isAllocated() const;
+
+    void push(float value);
+
+    int getCapacity() const;
+    int getLevelNum() const;
+    // Samples pushed since the last clear
+    int64_t getSampleNum() const;
+    // Samples reachable through the coarsest level
+    int64_t getSpan() const;
+    size_t getMemorySize() const;
+    float getLast() const;
+
+    // Reduces the newest `samples` samples to `columns` min/max pairs, oldest
+    // first, reading from the coarsest level that still resolves one column.
+    // Returns the number of columns written, which is fewer when less history
+    // is available. Cost is O(columns), independent of the sample count, as
+    // long as the coarsest level resolves one column. Spans wider than that
+    // read each reachable coarsest bucket once, at most capacity + columns.
+    int decimate(int64_t samples, int columns, float* outMin, float* outMax) const;
+
+    // Binary snapshot of the whole history, load() reallocates to match it.
+    // Invalid or truncated data fails and leaves the history unchanged.
+    void save(std::vector<uint8_t>& out) const;
+    bool load(const uint8_t*& cursor, const uint8_t* end);
+
+private:
+    struct Level {
+        std::vector<float> mins;
+        std::vector<float> maxs;
+        int64_t committed;       // Completed buckets
+        float partialmin, partialmax;
+        int partialcount;        // Child buckets in the open bucket
+    };
+
+    std::vector<float> samples;
+    std::vector<Level> levels;
+    int capacity;
+    int64_t mask;
+    int64_t count;
+
+    int64_t getBucketSize(int level) const;
+    void readBucket(int level, int64_t bucket, float& minValue, float& maxValue) const;
+};
+
+#endif /* SRC_GIPGAUGEHISTORY_H_ */
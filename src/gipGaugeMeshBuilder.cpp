@@ -0,0 +1,271 @@
+/*
+ * gipGaugeMeshBuilder.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeMeshBuilder.h"
+#include "gipGaugeTickKernel.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+gipGaugeMeshBuilder::gipGaugeMeshBuilder() {
+    vertices = nullptr;
+    indices = nullptr;
+    vertexcapacity = indexcapacity = 0;
+    vertexnum = indexnum = 0;
+    staticvertexnum = staticindexnum = 0;
+    staticvalid = false;
+    rebuildingstatic = false;
+    overflowed = false;
+    vertexout = nullptr;
+    indexout = nullptr;
+    currentlayer = LAYER_BACKGROUND;
+    currentcolor = 0xffffffff;
+    linewidth = 1.0f;
+    textbackend = nullptr;
+}
+
+gipGaugeMeshBuilder::~gipGaugeMeshBuilder() {
+}
+
+void gipGaugeMeshBuilder::setBuffers(Vertex* newvertices, int vertexCapacity, uint32_t* newindices, int indexCapacity) {
+    vertices = newvertices;
+    indices = newindices;
+    vertexcapacity = std::max(0, vertexCapacity);
+    indexcapacity = std::max(0, indexCapacity);
+    vertexnum = indexnum = 0;
+    staticvertexnum = staticindexnum = 0;
+    staticvalid = false;
+}
+
+void gipGaugeMeshBuilder::setTextBackend(gipGaugeBackend* backend) {
+    textbackend = backend;
+}
+
+gipGaugeBackend* gipGaugeMeshBuilder::getTextBackend() const {
+    return textbackend;
+}
+
+void gipGaugeMeshBuilder::setLineWidth(float width) {
+    linewidth = std::max(0.0f, width);
+}
+
+float gipGaugeMeshBuilder::getLineWidth() const {
+    return linewidth;
+}
+
+void gipGaugeMeshBuilder::begin(bool rebuildStatic) {
+    rebuildingstatic = rebuildStatic || !staticvalid;
+    overflowed = false;
+    currentlayer = LAYER_BACKGROUND;
+    if (rebuildingstatic) {
+        staticvertexnum = staticindexnum = 0;
+        stagedvertices.clear();
+        stagedindices.clear();
+    }
+    vertexnum = staticvertexnum;
+    indexnum = staticindexnum;
+}
+
+void gipGaugeMeshBuilder::end() {
+    if (!rebuildingstatic) return;
+
+    // The static region is complete, the staged dynamic primitives follow it
+    staticvertexnum = vertexnum;
+    staticindexnum = indexnum;
+    staticvalid = true;
+    rebuildingstatic = false;
+    int stagedvertexnum = stagedvertices.size();
+    int stagedindexnum = stagedindices.size();
+    if (vertexnum + stagedvertexnum > vertexcapacity || indexnum + stagedindexnum > indexcapacity) {
+        overflowed = overflowed || stagedvertexnum > 0;
+        return;
+    }
+    if (stagedvertexnum > 0) std::memcpy(vertices + vertexnum, stagedvertices.data(), stagedvertexnum * sizeof(Vertex));
+    for (int i = 0; i < stagedindexnum; i++) indices[indexnum + i] = stagedindices[i] + vertexnum;
+    vertexnum += stagedvertexnum;
+    indexnum += stagedindexnum;
+}
+
+int gipGaugeMeshBuilder::getVertexNum() const {
+    return vertexnum;
+}
+
+int gipGaugeMeshBuilder::getIndexNum() const {
+    return indexnum;
+}
+
+int gipGaugeMeshBuilder::getStaticVertexNum() const {
+    return staticvertexnum;
+}
+
+int gipGaugeMeshBuilder::getStaticIndexNum() const {
+    return staticindexnum;
+}
+
+bool gipGaugeMeshBuilder::hasOverflowed() const {
+    return overflowed;
+}
+
+uint32_t gipGaugeMeshBuilder::packColor(const gColor& color) {
+    const float components[4] = {color.r, color.g, color.b, color.a};
+    uint32_t packed = 0;
+    for (int i = 0; i < 4; i++) {
+        float c = std::max(0.0f, std::min(1.0f, components[i]));
+        packed |= static_cast<uint32_t>(c * 255.0f + 0.5f) << (i * 8);
+    }
+    return packed;
+}
+
+bool gipGaugeMeshBuilder::isSkipped() const {
+    // Static layers are only recorded while rebuilding
+    return currentlayer < LAYER_NEEDLE && !rebuildingstatic;
+}
+
+int gipGaugeMeshBuilder::reserve(int vertexCount, int indexCount) {
+    if (rebuildingstatic && currentlayer >= LAYER_NEEDLE) {
+        // Indices are relative to the staging area until end() rebases them
+        int first = stagedvertices.size();
+        stagedvertices.resize(first + vertexCount);
+        stagedindices.resize(stagedindices.size() + indexCount);
+        vertexout = stagedvertices.data() + first;
+        indexout = stagedindices.data() + stagedindices.size() - indexCount;
+        return first;
+    }
+    if (vertexnum + vertexCount > vertexcapacity || indexnum + indexCount > indexcapacity) {
+        overflowed = true;
+        return -1;
+    }
+    int first = vertexnum;
+    vertexout = vertices + vertexnum;
+    indexout = indices + indexnum;
+    vertexnum += vertexCount;
+    indexnum += indexCount;
+    return first;
+}
+
+void gipGaugeMeshBuilder::addVertex(float x, float y) {
+    vertexout->x = x;
+    vertexout->y = y;
+    vertexout->color = currentcolor;
+    vertexout++;
+}
+
+void gipGaugeMeshBuilder::addTriangle(uint32_t a, uint32_t b, uint32_t c) {
+    indexout[0] = a;
+    indexout[1] = b;
+    indexout[2] = c;
+    indexout += 3;
+}
+
+void gipGaugeMeshBuilder::setLayer(int layer) {
+    currentlayer = layer;
+    if (textbackend) textbackend->setLayer(layer);
+}
+
+void gipGaugeMeshBuilder::setColor(const gColor& color) {
+    currentcolor = packColor(color);
+    if (textbackend) textbackend->setColor(color);
+}
+
+void gipGaugeMeshBuilder::drawLine(float x1, float y1, float x2, float y2) {
+    if (isSkipped()) return;
+    buildLine(x1, y1, x2, y2);
+}
+
+void gipGaugeMeshBuilder::buildLine(float x1, float y1, float x2, float y2) {
+    float dx = x2 - x1;
+    float dy = y2 - y1;
+    float length = std::sqrt(dx * dx + dy * dy);
+    if (length <= 0.0f) return;
+
+    // Quad of the line width centered on the segment
+    float scale = linewidth * 0.5f / length;
+    float nx = -dy * scale;
+    float ny = dx * scale;
+    int first = reserve(4, 6);
+    if (first < 0) return;
+    addVertex(x1 + nx, y1 + ny);
+    addVertex(x2 + nx, y2 + ny);
+    addVertex(x2 - nx, y2 - ny);
+    addVertex(x1 - nx, y1 - ny);
+    addTriangle(first, first + 1, first + 2);
+    addTriangle(first, first + 2, first + 3);
+}
+
+void gipGaugeMeshBuilder::drawArc(float x, float y, float radius, float startAngle, float endAngle, bool filled, int segments) {
+    if (isSkipped()) return;
+    buildArc(x, y, radius, startAngle, endAngle, filled, segments);
+}
+
+void gipGaugeMeshBuilder::drawCircle(float x, float y, float radius, bool filled, int segments) {
+    if (isSkipped()) return;
+    buildArc(x, y, radius, 0.0f, 360.0f, filled, segments);
+}
+
+void gipGaugeMeshBuilder::buildArc(float x, float y, float radius, float startAngle, float endAngle, bool filled, int segments) {
+    segments = std::max(1, segments);
+    int points = segments + 1;
+    arccosines.resize(points);
+    arcsines.resize(points);
+    gipGaugeTickKernel::directions(startAngle, (endAngle - startAngle) / segments, points, arccosines.data(), arcsines.data());
+
+    if (filled) {
+        // Fan around the center, the same pie shape the renderer fills
+        int first = reserve(points + 1, segments * 3);
+        if (first < 0) return;
+        addVertex(x, y);
+        for (int i = 0; i < points; i++) addVertex(x + radius * arccosines[i], y + radius * arcsines[i]);
+        for (int i = 0; i < segments; i++) addTriangle(first, first + 1 + i, first + 2 + i);
+        return;
+    }
+
+    // Outline as a band of the line width along the arc
+    float inner = radius - linewidth * 0.5f;
+    float outer = radius + linewidth * 0.5f;
+    int first = reserve(points * 2, segments * 6);
+    if (first < 0) return;
+    for (int i = 0; i < points; i++) {
+        addVertex(x + inner * arccosines[i], y + inner * arcsines[i]);
+        addVertex(x + outer * arccosines[i], y + outer * arcsines[i]);
+    }
+    for (int i = 0; i < segments; i++) {
+        int a = first + i * 2;
+        addTriangle(a, a + 1, a + 3);
+        addTriangle(a, a + 3, a + 2);
+    }
+}
+
+void gipGaugeMeshBuilder::drawRectangle(float x, float y, float w, float h, bool filled) {
+    if (isSkipped()) return;
+    if (!filled) {
+        buildLine(x, y, x + w, y);
+        buildLine(x + w, y, x + w, y + h);
+        buildLine(x + w, y + h, x, y + h);
+        buildLine(x, y + h, x, y);
+        return;
+    }
+    int first = reserve(4, 6);
+    if (first < 0) return;
+    addVertex(x, y);
+    addVertex(x + w, y);
+    addVertex(x + w, y + h);
+    addVertex(x, y + h);
+    addTriangle(first, first + 1, first + 2);
+    addTriangle(first, first + 2, first + 3);
+}
+
+void gipGaugeMeshBuilder::drawText(const std::string& text, float x, float y, int fontSize) {
+    if (textbackend) textbackend->drawText(text, x, y, fontSize);
+}
+
+void gipGaugeMeshBuilder::drawValueText(const std::string& text, float x, float y, int fontSize) {
+    if (textbackend) textbackend->drawValueText(text, x, y, fontSize);
+}
+
+void gipGaugeMeshBuilder::measureText(const std::string& text, int fontSize, float& width, float& height) {
+    if (textbackend) textbackend->measureText(text, fontSize, width, height);
+    else gipGaugeBackend::measureText(text, fontSize, width, height);
+}
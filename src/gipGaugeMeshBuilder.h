@@ -0,0 +1,108 @@
+/*
+ * gipGaugeMeshBuilder.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGEMESHBUILDER_H_
+#define SRC_GIPGAUGEMESHBUILDER_H_
+
+#include "gipGaugeBackend.h"
+#include "gipGaugeAllocator.h"
+#include <vector>
+#include <cstdint>
+
+// Backend tessellating gauge primitives into one caller-provided triangle
+// list, so a whole dashboard can be uploaded and drawn with a single call.
+// Pure CPU, no renderer or GL context is touched.
+//
+// The buffers are split in two regions. The static region at the start holds
+// backgrounds, zones and ticks and is only rebuilt on request. The dynamic
+// region right after it holds needles, bars and markers and is rebuilt every
+// frame, so only its range has to be re-uploaded. Text is not tessellated,
+// it is forwarded every frame to the text backend if one is set.
+//
+//   mesh.setBuffers(vertices, vertexcapacity, indices, indexcapacity);
+//   mesh.begin(layoutchanged);
+//   for (gipGauge* gauge : gauges) gauge->draw(...);  // With mesh as backend
+//   mesh.end();
+class gipGaugeMeshBuilder : public gipGaugeBackend {
+public:
+    struct Vertex {
+        float x, y;
+        uint32_t color;     // RGBA8, red in the lowest byte
+    };
+
+    gipGaugeMeshBuilder();
+    virtual ~gipGaugeMeshBuilder();
+
+    // Output storage, owned by the caller. Changing it invalidates the static region.
+    void setBuffers(Vertex* vertices, int vertexCapacity, uint32_t* indices, int indexCapacity);
+    // Receives text primitives, nullptr drops them
+    void setTextBackend(gipGaugeBackend* backend);
+    gipGaugeBackend* getTextBackend() const;
+    // Width of lines and outlines in pixels
+    void setLineWidth(float width);
+    float getLineWidth() const;
+
+    // Starts a frame. With rebuildStatic, or after setBuffers(), the static
+    // region is recorded again, otherwise primitives of the static layers are
+    // skipped. Rebuild after any change of layout or configuration.
+    void begin(bool rebuildStatic);
+    void end();
+
+    int getVertexNum() const;
+    int getIndexNum() const;
+    // The static region spans [0, getStaticVertexNum()) and [0, getStaticIndexNum()),
+    // the dynamic region the rest
+    int getStaticVertexNum() const;
+    int getStaticIndexNum() const;
+    // True if primitives were dropped for lack of buffer space since begin()
+    bool hasOverflowed() const;
+
+    static uint32_t packColor(const gColor& color);
+
+    void setLayer(int layer);
+    void setColor(const gColor& color);
+    void drawLine(float x1, float y1, float x2, float y2);
+    void drawArc(float x, float y, float radius, float startAngle, float endAngle, bool filled, int segments);
+    void drawCircle(float x, float y, float radius, bool filled, int segments);
+    void drawRectangle(float x, float y, float w, float h, bool filled);
+    void drawText(const std::string& text, float x, float y, int fontSize);
+    void drawValueText(const std::string& text, float x, float y, int fontSize);
+    void measureText(const std::string& text, int fontSize, float& width, float& height);
+
+private:
+    Vertex* vertices;
+    uint32_t* indices;
+    int vertexcapacity, indexcapacity;
+    int vertexnum, indexnum;
+    int staticvertexnum, staticindexnum;
+    bool staticvalid;
+    bool rebuildingstatic;
+    bool overflowed;
+
+    // Dynamic primitives of a rebuild frame, appended after the static region by end()
+    gipGaugeVector<Vertex> stagedvertices;
+    gipGaugeVector<uint32_t> stagedindices;
+    Vertex* vertexout;
+    uint32_t* indexout;
+
+    int currentlayer;
+    uint32_t currentcolor;
+    float linewidth;
+    gipGaugeBackend* textbackend;
+
+    // Unit vectors of arc segments, reused between primitives
+    gipGaugeVector<float> arccosines, arcsines;
+
+    bool isSkipped() const;
+    // Reserves space and returns the index of the first vertex, or -1 on overflow
+    int reserve(int vertexCount, int indexCount);
+    void addVertex(float x, float y);
+    void addTriangle(uint32_t a, uint32_t b, uint32_t c);
+    void buildLine(float x1, float y1, float x2, float y2);
+    void buildArc(float x, float y, float radius, float startAngle, float endAngle, bool filled, int segments);
+};
+
+#endif /* SRC_GIPGAUGEMESHBUILDER_H_ */
@@ -0,0 +1,460 @@
+/*
+ * gipGaugeReplay.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeReplay.h"
+#include "gipGauge.h"
+#include <algorithm>
+
+static const uint32_t logmagic = 0x52504947;    // "GIPR"
+static const uint32_t indexmagic = 0x58504947;  // "GIPX"
+static const uint32_t logversion = 3;
+static const uint64_t headersize = 16;
+static const uint64_t recordsize = sizeof(gipGaugeReplayRecord);
+static const size_t chunkrecords = 4096;
+
+// 64-bit offsets, logs can be larger than 2 GB
+static bool seekFile(FILE* file, uint64_t offset) {
+#ifdef _WIN32
+    return _fseeki64(file, static_cast<__int64>(offset), SEEK_SET) == 0;
+#else
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
+
+static uint64_t getFileSize(FILE* file) {
+#ifdef _WIN32
+    if (_fseeki64(file, 0, SEEK_END) != 0) return 0;
+    return _ftelli64(file);
+#else
+    if (fseeko(file, 0, SEEK_END) != 0) return 0;
+    return ftello(file);
+#endif
+}
+
+gipGaugeReplayWriter::gipGaugeReplayWriter() {
+    file = nullptr;
+    checkpointfile = nullptr;
+    recordnum = 0;
+    lasttimestamp = 0;
+    indexinterval = 4096;
+    keyframeinterval = 64;
+    checkpointnum = 0;
+}
+
+gipGaugeReplayWriter::~gipGaugeReplayWriter() {
+    close();
+}
+
+bool gipGaugeReplayWriter::open(const std::string& path) {
+    close();
+    file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) return false;
+    checkpointfile = std::tmpfile();
+    if (checkpointfile == nullptr) {
+        std::fclose(file);
+        file = nullptr;
+        return false;
+    }
+    uint32_t header[4] = {logmagic, logversion, static_cast<uint32_t>(recordsize), 0};
+    std::fwrite(header, sizeof(header), 1, file);
+    recordnum = 0;
+    lasttimestamp = 0;
+    index.clear();
+    checkpointnum = 0;
+    checkpointbuffer.clear();
+    checkpointbuffer.reserve(chunkrecords);
+    lastvalues.clear();
+    seen.clear();
+    changed.clear();
+    changedids.clear();
+    buffer.clear();
+    buffer.reserve(chunkrecords);
+    return true;
+}
+
+void gipGaugeReplayWriter::close() {
+    if (file == nullptr) return;
+    flush();
+    flushCheckpoints();
+    uint64_t indexoffset = headersize + recordnum * recordsize;
+    if (!index.empty()) std::fwrite(index.data(), sizeof(IndexEntry), index.size(), file);
+
+    // Copy the streamed checkpoints behind the index, one chunk at a time
+    checkpointbuffer.resize(chunkrecords);
+    std::rewind(checkpointfile);
+    size_t count;
+    while ((count = std::fread(checkpointbuffer.data(), sizeof(gipGaugeReplayCheckpoint), chunkrecords, checkpointfile)) > 0) {
+        std::fwrite(checkpointbuffer.data(), sizeof(gipGaugeReplayCheckpoint), count, file);
+    }
+    checkpointbuffer.clear();
+    std::fclose(checkpointfile);
+    checkpointfile = nullptr;
+
+    uint32_t trailer[8] = {
+        static_cast<uint32_t>(indexoffset), static_cast<uint32_t>(indexoffset >> 32),
+        static_cast<uint32_t>(index.size()),
+        static_cast<uint32_t>(checkpointnum), static_cast<uint32_t>(checkpointnum >> 32),
+        static_cast<uint32_t>(keyframeinterval), 0, indexmagic
+    };
+    std::fwrite(trailer, sizeof(trailer), 1, file);
+    std::fclose(file);
+    file = nullptr;
+}
+
+bool gipGaugeReplayWriter::isOpen() const {
+    return file != nullptr;
+}
+
+void gipGaugeReplayWriter::setIndexInterval(int records) {
+    indexinterval = std::max(1, records);
+}
+
+void gipGaugeReplayWriter::setKeyframeInterval(int entries) {
+    keyframeinterval = std::max(1, entries);
+}
+
+void gipGaugeReplayWriter::write(uint64_t timestamp, uint32_t gaugeid, float value) {
+    if (file == nullptr) return;
+    timestamp = std::max(timestamp, lasttimestamp);
+    if (recordnum % indexinterval == 0) {
+        // Checkpoint the state before this record, in full on keyframes and
+        // as the gauges changed since the previous entry otherwise
+        index.push_back({timestamp, recordnum, checkpointnum});
+        if ((index.size() - 1) % keyframeinterval == 0) {
+            for (size_t i = 0; i < seen.size(); i++) {
+                if (seen[i]) writeCheckpoint(i);
+            }
+        } else {
+            for (uint32_t id : changedids) writeCheckpoint(id);
+        }
+        for (uint32_t id : changedids) changed[id] = 0;
+        changedids.clear();
+    }
+    if (gaugeid >= seen.size()) {
+        seen.resize(gaugeid + 1, 0);
+        changed.resize(gaugeid + 1, 0);
+        lastvalues.resize(gaugeid + 1, 0.0f);
+    }
+    seen[gaugeid] = 1;
+    lastvalues[gaugeid] = value;
+    if (!changed[gaugeid]) {
+        changed[gaugeid] = 1;
+        changedids.push_back(gaugeid);
+    }
+    buffer.push_back({timestamp, gaugeid, value});
+    lasttimestamp = timestamp;
+    recordnum++;
+    if (buffer.size() >= chunkrecords) flush();
+}
+
+uint64_t gipGaugeReplayWriter::getRecordNum() const {
+    return recordnum;
+}
+
+void gipGaugeReplayWriter::flush() {
+    if (buffer.empty()) return;
+    std::fwrite(buffer.data(), recordsize, buffer.size(), file);
+    buffer.clear();
+}
+
+void gipGaugeReplayWriter::writeCheckpoint(uint32_t gaugeid) {
+    checkpointbuffer.push_back({gaugeid, lastvalues[gaugeid]});
+    checkpointnum++;
+    if (checkpointbuffer.size() >= chunkrecords) flushCheckpoints();
+}
+
+void gipGaugeReplayWriter::flushCheckpoints() {
+    if (checkpointbuffer.empty()) return;
+    std::fwrite(checkpointbuffer.data(), sizeof(gipGaugeReplayCheckpoint), checkpointbuffer.size(), checkpointfile);
+    checkpointbuffer.clear();
+}
+
+gipGaugeReplay::gipGaugeReplay() {
+    file = nullptr;
+    recordnum = 0;
+    starttime = endtime = 0;
+    checkpointoffset = 0;
+    checkpointnum = 0;
+    keyframeinterval = 1;
+    bufferstart = 0;
+    buffercount = 0;
+    nextrecord = 0;
+    clock = 0.0;
+    speed = 1.0f;
+    batchsize = 4096;
+    loop = false;
+    hasupdated = false;
+}
+
+gipGaugeReplay::~gipGaugeReplay() {
+    close();
+}
+
+bool gipGaugeReplay::open(const std::string& path) {
+    close();
+    file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) return false;
+
+    uint64_t filesize = getFileSize(file);
+    uint32_t header[4];
+    if (filesize < headersize || !seekFile(file, 0) || std::fread(header, sizeof(header), 1, file) != 1 ||
+        header[0] != logmagic || header[1] != logversion || header[2] != recordsize) {
+        close();
+        return false;
+    }
+
+    // Use the footer when the writer closed the log cleanly
+    uint64_t recordend = filesize;
+    uint32_t trailer[8];
+    if (filesize >= headersize + sizeof(trailer) && seekFile(file, filesize - sizeof(trailer)) &&
+        std::fread(trailer, sizeof(trailer), 1, file) == 1 && trailer[7] == indexmagic) {
+        uint64_t indexoffset = trailer[0] | (static_cast<uint64_t>(trailer[1]) << 32);
+        uint64_t indexsize = static_cast<uint64_t>(trailer[2]) * sizeof(IndexEntry);
+        uint64_t checkpoints = trailer[3] | (static_cast<uint64_t>(trailer[4]) << 32);
+        uint64_t checkpointsize = checkpoints * sizeof(gipGaugeReplayCheckpoint);
+        // Sizes are checked against the file before anything is allocated
+        if (indexoffset >= headersize && indexoffset <= filesize && indexsize <= filesize &&
+            checkpointsize <= filesize && indexoffset + indexsize + checkpointsize + sizeof(trailer) == filesize) {
+            uint64_t indexedrecords = (indexoffset - headersize) / recordsize;
+            index.resize(trailer[2]);
+            bool valid = trailer[5] > 0 && (index.empty() || (seekFile(file, indexoffset) &&
+                         std::fread(index.data(), sizeof(IndexEntry), index.size(), file) == index.size()));
+            // Entries must point into the records and checkpoints in order
+            for (size_t i = 0; valid && i < index.size(); i++) {
+                uint64_t next = i + 1 < index.size() ? index[i + 1].checkpoint : checkpoints;
+                valid = index[i].record < indexedrecords && index[i].checkpoint <= next && next <= checkpoints &&
+                        (i == 0 || (index[i].record > index[i - 1].record && index[i].timestamp >= index[i - 1].timestamp));
+            }
+            // A damaged index still bounds the records, seeking then replays them
+            recordend = indexoffset;
+            if (valid) {
+                checkpointoffset = indexoffset + indexsize;
+                checkpointnum = checkpoints;
+                keyframeinterval = trailer[5];
+            } else {
+                index.clear();
+            }
+        }
+    }
+    recordnum = (recordend - headersize) / recordsize;
+
+    buffer.resize(chunkrecords);
+    gipGaugeReplayRecord record;
+    if (recordnum > 0 && readRecord(recordnum - 1, record)) endtime = record.timestamp;
+    if (recordnum > 0 && readRecord(0, record)) starttime = record.timestamp;
+    rewind();
+    return true;
+}
+
+void gipGaugeReplay::close() {
+    if (file) std::fclose(file);
+    file = nullptr;
+    recordnum = 0;
+    starttime = endtime = 0;
+    index.clear();
+    checkpointoffset = 0;
+    checkpointnum = 0;
+    keyframeinterval = 1;
+    buffer.clear();
+    bufferstart = 0;
+    buffercount = 0;
+    nextrecord = 0;
+}
+
+bool gipGaugeReplay::isOpen() const {
+    return file != nullptr;
+}
+
+void gipGaugeReplay::setGauge(uint32_t gaugeid, gipGauge* gauge) {
+    if (gaugeid >= gauges.size()) {
+        if (gauge == nullptr) return;
+        gauges.resize(gaugeid + 1, nullptr);
+    }
+    gauges[gaugeid] = gauge;
+}
+
+void gipGaugeReplay::clearGauges() {
+    gauges.clear();
+}
+
+void gipGaugeReplay::setSpeed(float newspeed) {
+    speed = newspeed;
+}
+
+float gipGaugeReplay::getSpeed() const {
+    return speed;
+}
+
+void gipGaugeReplay::setBatchSize(int records) {
+    batchsize = std::max(1, records);
+}
+
+void gipGaugeReplay::setLoop(bool enabled) {
+    loop = enabled;
+}
+
+void gipGaugeReplay::update() {
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    double deltaTime = 0.0;
+    if (hasupdated) deltaTime = std::chrono::duration<double>(now - lastupdatetime).count();
+    lastupdatetime = now;
+    hasupdated = true;
+    advance(deltaTime);
+}
+
+int gipGaugeReplay::advance(double seconds) {
+    if (file == nullptr) return 0;
+    if (nextrecord >= recordnum) {
+        if (!loop || recordnum == 0) return 0;
+        rewind();
+    }
+
+    int delivered = 0;
+    gipGaugeReplayRecord record;
+    if (speed <= 0.0f) {
+        // As fast as possible, the clock follows the records
+        while (delivered < batchsize && nextrecord < recordnum && readRecord(nextrecord, record)) {
+            deliver(record);
+            clock = record.timestamp;
+            nextrecord++;
+            delivered++;
+        }
+        return delivered;
+    }
+
+    clock += seconds * 1e6 * speed;
+    while (nextrecord < recordnum && readRecord(nextrecord, record) && record.timestamp <= clock) {
+        deliver(record);
+        nextrecord++;
+        delivered++;
+    }
+    return delivered;
+}
+
+void gipGaugeReplay::seek(uint64_t timestamp) {
+    if (file == nullptr) return;
+    uint64_t target = findRecord(timestamp);
+
+    // Start from the last entry at or before the target, or from the first
+    // record of a log without a footer
+    std::vector<float> lastvalues(gauges.size());
+    std::vector<char> touched(gauges.size(), 0);
+    uint64_t first = 0;
+    std::vector<IndexEntry>::const_iterator it = std::upper_bound(index.begin(), index.end(), target,
+        [](uint64_t record, const IndexEntry& entry) { return record < entry.record; });
+    if (it != index.begin()) {
+        // The keyframe before the entry and the changes up to the entry are
+        // contiguous, fold them forward one chunk at a time
+        size_t entry = (it - index.begin()) - 1;
+        uint64_t checkpoint = index[entry - entry % keyframeinterval].checkpoint;
+        uint64_t end = it != index.end() ? it->checkpoint : checkpointnum;
+        std::vector<gipGaugeReplayCheckpoint> chunk(static_cast<size_t>(std::min<uint64_t>(chunkrecords, end - checkpoint)));
+        bool complete = seekFile(file, checkpointoffset + checkpoint * sizeof(gipGaugeReplayCheckpoint));
+        while (complete && checkpoint < end) {
+            size_t count = static_cast<size_t>(std::min<uint64_t>(chunk.size(), end - checkpoint));
+            complete = std::fread(chunk.data(), sizeof(gipGaugeReplayCheckpoint), count, file) == count;
+            for (size_t i = 0; complete && i < count; i++) {
+                if (chunk[i].gaugeid >= gauges.size()) continue;
+                lastvalues[chunk[i].gaugeid] = chunk[i].value;
+                touched[chunk[i].gaugeid] = 1;
+            }
+            checkpoint += count;
+        }
+        if (complete) {
+            first = index[entry].record;
+        } else {
+            std::fill(touched.begin(), touched.end(), 0);
+        }
+    }
+
+    // Replay the records up to the target silently, keeping only each gauge's last value
+    gipGaugeReplayRecord record;
+    for (uint64_t r = first; r < target && readRecord(r, record); r++) {
+        if (record.gaugeid >= gauges.size()) continue;
+        lastvalues[record.gaugeid] = record.value;
+        touched[record.gaugeid] = 1;
+    }
+    for (size_t i = 0; i < gauges.size(); i++) {
+        if (touched[i] && gauges[i]) gauges[i]->setValue(lastvalues[i]);
+    }
+
+    nextrecord = target;
+    clock = static_cast<double>(std::max(timestamp, starttime));
+}
+
+void gipGaugeReplay::rewind() {
+    nextrecord = 0;
+    clock = static_cast<double>(starttime);
+}
+
+bool gipGaugeReplay::isFinished() const {
+    return nextrecord >= recordnum;
+}
+
+uint64_t gipGaugeReplay::getTime() const {
+    return static_cast<uint64_t>(clock);
+}
+
+uint64_t gipGaugeReplay::getStartTime() const {
+    return starttime;
+}
+
+uint64_t gipGaugeReplay::getEndTime() const {
+    return endtime;
+}
+
+uint64_t gipGaugeReplay::getRecordNum() const {
+    return recordnum;
+}
+
+uint64_t gipGaugeReplay::getRecordIndex() const {
+    return nextrecord;
+}
+
+bool gipGaugeReplay::readRecord(uint64_t record, gipGaugeReplayRecord& out) {
+    if (record < bufferstart || record >= bufferstart + buffercount) {
+        if (!loadChunk(record)) return false;
+    }
+    out = buffer[record - bufferstart];
+    return true;
+}
+
+bool gipGaugeReplay::loadChunk(uint64_t record) {
+    buffercount = 0;
+    if (record >= recordnum || !seekFile(file, headersize + record * recordsize)) return false;
+    size_t wanted = static_cast<size_t>(std::min<uint64_t>(chunkrecords, recordnum - record));
+    bufferstart = record;
+    buffercount = std::fread(buffer.data(), recordsize, wanted, file);
+    return buffercount > 0;
+}
+
+uint64_t gipGaugeReplay::findRecord(uint64_t timestamp) {
+    // Narrow down with the sparse index, then binary-search the records
+    uint64_t low = 0;
+    uint64_t high = recordnum;
+    if (!index.empty()) {
+        std::vector<IndexEntry>::const_iterator it = std::lower_bound(index.begin(), index.end(), timestamp,
+            [](const IndexEntry& entry, uint64_t time) { return entry.timestamp < time; });
+        if (it != index.end()) high = it->record;
+        if (it != index.begin()) low = (it - 1)->record;
+    }
+
+    gipGaugeReplayRecord record;
+    while (low < high) {
+        uint64_t middle = low + (high - low) / 2;
+        if (!readRecord(middle, record)) break;
+        if (record.timestamp < timestamp) low = middle + 1;
+        else high = middle;
+    }
+    return low;
+}
+
+void gipGaugeReplay::deliver(const gipGaugeReplayRecord& record) {
+    if (record.gaugeid >= gauges.size() || gauges[record.gaugeid] == nullptr) return;
+    gipGauge* gauge = gauges[record.gaugeid];
+    // Streams keep every sample when the gauge has a sample buffer
+    if (gauge->getSampleBufferSize() == 0 || !gauge->pushSample(record.value)) gauge->setValue(record.value);
+}
@@ -0,0 +1,163 @@
+/*
+ * gipGaugeReplay.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGEREPLAY_H_
+#define SRC_GIPGAUGEREPLAY_H_
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <chrono>
+
+class gipGauge;
+
+// Replay log layout, little-endian:
+//  - header: magic "GIPR", version, record size
+//  - records of 16 bytes sorted by timestamp: microseconds, gauge id, value
+//  - optional footer: sparse index of (timestamp, record, checkpoint)
+//    entries, the checkpoints, then a trailer with the index offset, entry
+//    count, checkpoint count, keyframe interval and magic "GIPX". Every
+//    keyframe interval'th entry is a keyframe whose checkpoint holds the last
+//    (gauge id, value) of every gauge seen before its record. The other
+//    entries only hold the gauges that changed since the previous entry.
+// A log cut short by a crash has no footer and is still readable, but every
+// seek then replays all records from the start, O(records) per seek.
+struct gipGaugeReplayRecord {
+    uint64_t timestamp;
+    uint32_t gaugeid;
+    float value;
+};
+
+struct gipGaugeReplayCheckpoint {
+    uint32_t gaugeid;
+    float value;
+};
+
+class gipGaugeReplayWriter {
+public:
+    gipGaugeReplayWriter();
+    virtual ~gipGaugeReplayWriter();
+
+    bool open(const std::string& path);
+    // Writes the index footer and closes the file
+    void close();
+    bool isOpen() const;
+
+    // One index entry and checkpoint every this many records, and a full
+    // keyframe checkpoint every this many entries. Checkpoints are streamed
+    // to a temporary file as they are taken and copied into the footer by
+    // close(), the writer only keeps the index and one value per gauge.
+    void setIndexInterval(int records);
+    void setKeyframeInterval(int entries);
+    // Timestamps in microseconds, earlier timestamps are raised to the last one
+    void write(uint64_t timestamp, uint32_t gaugeid, float value);
+    uint64_t getRecordNum() const;
+
+private:
+    struct IndexEntry {
+        uint64_t timestamp;
+        uint64_t record;
+        uint64_t checkpoint;    // First checkpoint of the entry
+    };
+
+    FILE* file;
+    FILE* checkpointfile;       // Anonymous temporary file
+    uint64_t recordnum;
+    uint64_t lasttimestamp;
+    int indexinterval;
+    int keyframeinterval;
+    std::vector<IndexEntry> index;
+    uint64_t checkpointnum;
+    std::vector<gipGaugeReplayCheckpoint> checkpointbuffer;
+    std::vector<float> lastvalues;
+    std::vector<char> seen;
+    std::vector<char> changed;
+    std::vector<uint32_t> changedids;  // Gauges changed since the last entry
+    std::vector<gipGaugeReplayRecord> buffer;
+
+    void flush();
+    void writeCheckpoint(uint32_t gaugeid);
+    void flushCheckpoints();
+};
+
+// Streams a replay log in fixed-size chunks, so logs of any size play in
+// constant memory, and feeds the records to registered gauges.
+class gipGaugeReplay {
+public:
+    gipGaugeReplay();
+    virtual ~gipGaugeReplay();
+
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const;
+
+    // Records with this id go to the gauge, nullptr removes the mapping
+    void setGauge(uint32_t gaugeid, gipGauge* gauge);
+    void clearGauges();
+
+    // 1 plays at real time, 4 four times faster. 0 or less plays as fast as
+    // possible, up to the batch size records per update().
+    void setSpeed(float speed);
+    float getSpeed() const;
+    void setBatchSize(int records);
+    void setLoop(bool loop);
+
+    // Advances by the wall-clock time since the last update()
+    void update();
+    // Advances the log clock by a fixed amount of real seconds, scaled by the
+    // speed, for deterministic playback. Returns the records delivered.
+    int advance(double seconds);
+    // Jumps to a log timestamp. Each gauge gets the last value it had before
+    // the target, restored from the nearest keyframe, the changes after it
+    // and the records after the nearest entry, however long ago the gauge
+    // last changed. Without a footer this replays the log from the start.
+    void seek(uint64_t timestamp);
+    void rewind();
+
+    bool isFinished() const;
+    uint64_t getTime() const;
+    uint64_t getStartTime() const;
+    uint64_t getEndTime() const;
+    uint64_t getRecordNum() const;
+    uint64_t getRecordIndex() const;
+
+private:
+    struct IndexEntry {
+        uint64_t timestamp;
+        uint64_t record;
+        uint64_t checkpoint;
+    };
+
+    FILE* file;
+    uint64_t recordnum;
+    uint64_t starttime, endtime;
+    std::vector<IndexEntry> index;
+    uint64_t checkpointoffset;
+    uint64_t checkpointnum;
+    uint64_t keyframeinterval;
+    std::vector<gipGauge*> gauges;
+
+    // Read-ahead chunk
+    std::vector<gipGaugeReplayRecord> buffer;
+    uint64_t bufferstart;
+    size_t buffercount;
+    uint64_t nextrecord;
+
+    double clock;       // Log time in microseconds
+    float speed;
+    int batchsize;
+    bool loop;
+    std::chrono::steady_clock::time_point lastupdatetime;
+    bool hasupdated;
+
+    bool readRecord(uint64_t record, gipGaugeReplayRecord& out);
+    bool loadChunk(uint64_t record);
+    uint64_t findRecord(uint64_t timestamp);
+    void deliver(const gipGaugeReplayRecord& record);
+};
+
+#endif /* SRC_GIPGAUGEREPLAY_H_ */
@@ -0,0 +1,222 @@
+/*
+ * gipGaugeSampleRing.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGESAMPLERING_H_
+#define SRC_GIPGAUGESAMPLERING_H_
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+// Latest-value slot written by any number of producer threads and read by the
+// render thread. Producers never block; the consumer only sees the newest value.
+// The value and a publish generation share one 64-bit word, so the consumer
+// sees each publish at most once even when a producer races it.
+class gipGaugeValueSlot {
+public:
+    gipGaugeValueSlot() : word(0), consumed(0) {}
+
+    // Copies carry the published value over, a pending publish included
+    gipGaugeValueSlot(const gipGaugeValueSlot& other)
+        : word(other.word.load(std::memory_order_acquire)),
+          consumed(other.consumed) {}
+
+    gipGaugeValueSlot& operator=(const gipGaugeValueSlot& other) {
+        word.store(other.word.load(std::memory_order_acquire), std::memory_order_release);
+        consumed = other.consumed;
+        return *this;
+    }
+
+    // Producer side
+    void publish(float newvalue) {
+        uint32_t bits;
+        std::memcpy(&bits, &newvalue, sizeof(bits));
+        uint64_t current = word.load(std::memory_order_relaxed);
+        uint64_t next;
+        do {
+            uint32_t generation = static_cast<uint32_t>(current >> 32) + 1;
+            next = (static_cast<uint64_t>(generation) << 32) | bits;
+        } while (!word.compare_exchange_weak(current, next,
+                std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // Consumer side, returns false if nothing was published since the last call
+    bool consume(float& out) {
+        uint64_t current = word.load(std::memory_order_acquire);
+        uint32_t generation = static_cast<uint32_t>(current >> 32);
+        if (generation == consumed) return false;
+        consumed = generation;
+        uint32_t bits = static_cast<uint32_t>(current);
+        std::memcpy(&out, &bits, sizeof(out));
+        return true;
+    }
+
+private:
+    std::atomic<uint64_t> word;     // Generation in the high half, value bits in the low half
+    uint32_t consumed;              // Last generation seen, owned by the consumer
+};
+
+// Bounded single-producer/single-consumer ring. Capacity is rounded up to a
+// power of two; allocate() must be called before the producer starts.
+template<typename T>
+class gipGaugeSampleRing {
+public:
+    gipGaugeSampleRing() : mask(0), head(0), tail(0) {}
+
+    // Copies get the same capacity but start empty, samples in flight stay
+    // with the original ring
+    gipGaugeSampleRing(const gipGaugeSampleRing& other) : mask(0), head(0), tail(0) {
+        allocate(other.getCapacity());
+    }
+
+    gipGaugeSampleRing& operator=(const gipGaugeSampleRing& other) {
+        if (this != &other) allocate(other.getCapacity());
+        return *this;
+    }
+
+    void allocate(size_t capacity) {
+        size_t size = 0;
+        if (capacity > 0) {
+            size = 1;
+            while (size < capacity) size <<= 1;
+        }
+        buffer.assign(size, T());
+        mask = size > 0 ? size - 1 : 0;
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+    }
+
+    size_t getCapacity() const {
+        return buffer.size();
+    }
+
+    bool isAllocated() const {
+        return !buffer.empty();
+    }
+
+    // Producer side, returns false if the ring is full
+    bool push(const T& item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= buffer.size()) return false;
+        buffer[h & mask] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side, returns false if the ring is empty
+    bool pop(T& item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return false;
+        item = buffer[t & mask];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+private:
+    std::vector<T> buffer;
+    size_t mask;
+    alignas(64) std::atomic<size_t> head;  // Written by the producer only
+    alignas(64) std::atomic<size_t> tail;  // Written by the consumer only
+};
+
+// Bounded multi-producer/single-consumer ring. Every cell carries a sequence
+// number, so producers claim cells with one CAS on the head and publish them
+// on their own, and the consumer takes them in claim order. Capacity is
+// rounded up to a power of two; allocate() must be called before any
+// producer starts and not again while producers may push.
+template<typename T>
+class gipGaugeSharedRing {
+public:
+    gipGaugeSharedRing() : mask(0), capacity(0), head(0), tail(0) {}
+
+    // Copies get the same capacity but start empty
+    gipGaugeSharedRing(const gipGaugeSharedRing& other) : mask(0), capacity(0), head(0), tail(0) {
+        allocate(other.getCapacity());
+    }
+
+    gipGaugeSharedRing& operator=(const gipGaugeSharedRing& other) {
+        if (this != &other) allocate(other.getCapacity());
+        return *this;
+    }
+
+    void allocate(size_t newcapacity) {
+        size_t size = 0;
+        if (newcapacity > 0) {
+            size = 1;
+            while (size < newcapacity) size <<= 1;
+        }
+        cells.reset(size > 0 ? new Cell[size] : nullptr);
+        for (size_t i = 0; i < size; i++) cells[i].sequence.store(i, std::memory_order_relaxed);
+        capacity = size;
+        mask = size > 0 ? size - 1 : 0;
+        head.store(0, std::memory_order_relaxed);
+        tail = 0;
+    }
+
+    size_t getCapacity() const {
+        return capacity;
+    }
+
+    bool isAllocated() const {
+        return capacity > 0;
+    }
+
+    // Producer side, any thread, returns false if the ring is full
+    bool push(const T& item) {
+        if (capacity == 0) return false;
+        size_t h = head.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[h & mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - h);
+            if (difference == 0) {
+                if (head.compare_exchange_weak(h, h + 1, std::memory_order_relaxed)) {
+                    cell.item = item;
+                    cell.sequence.store(h + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                h = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer side, returns false if the ring is empty or the oldest claimed
+    // cell is still being written
+    bool pop(T& item) {
+        if (capacity == 0) return false;
+        Cell& cell = cells[tail & mask];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (static_cast<std::ptrdiff_t>(sequence - (tail + 1)) < 0) return false;
+        item = cell.item;
+        cell.sequence.store(tail + capacity, std::memory_order_release);
+        tail++;
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T item;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+    size_t capacity;
+    alignas(64) std::atomic<size_t> head;  // Claimed by producers
+    alignas(64) size_t tail;               // Owned by the consumer
+};
+
+#endif /* SRC_GIPGAUGESAMPLERING_H_ */
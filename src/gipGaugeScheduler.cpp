@@ -0,0 +1,115 @@
+/*
+ * gipGaugeScheduler.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeScheduler.h"
+#include "gipGauge.h"
+#include <algorithm>
+
+gipGaugeScheduler::gipGaugeScheduler() {
+    wakehead = nullptr;
+    hasupdated = false;
+}
+
+gipGaugeScheduler::~gipGaugeScheduler() {
+    // Leave attached gauges updating themselves in draw()
+    for (gipGauge* gauge : gauges) gauge->detachScheduler();
+}
+
+void gipGaugeScheduler::update(float deltaTime) {
+    drainWakes();
+    deltaTime = std::max(deltaTime, 0.0f);
+    for (size_t i = 0; i < active.size();) {
+        gipGauge* gauge = active[i];
+        if (gauge->step(deltaTime)) i++;
+        else deactivate(gauge);  // The last active gauge moves into slot i
+    }
+}
+
+void gipGaugeScheduler::update() {
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    float deltaTime = 1.0f / 60.0f;
+    if (hasupdated) {
+        deltaTime = std::chrono::duration<float>(now - lastupdatetime).count();
+        deltaTime = std::min(deltaTime, 0.25f);  // Don't jump after stalls
+    }
+    lastupdatetime = now;
+    hasupdated = true;
+    update(deltaTime);
+}
+
+void gipGaugeScheduler::attach(gipGauge* gauge) {
+    gipGauge::SchedulerBinding& binding = gauge->schedulerbinding;
+    if (binding.index >= 0) return;
+    binding.index = gauges.size();
+    gauges.push_back(gauge);
+    // Step once, it may hold samples from before it was attached
+    activate(gauge);
+}
+
+void gipGaugeScheduler::detach(gipGauge* gauge) {
+    gipGauge::SchedulerBinding& binding = gauge->schedulerbinding;
+    if (binding.index < 0) return;
+    // A queued wake must not outlive the membership
+    drainWakes();
+    deactivate(gauge);
+    gipGauge* last = gauges.back();
+    gauges[binding.index] = last;
+    last->schedulerbinding.index = binding.index;
+    gauges.pop_back();
+    binding.index = -1;
+}
+
+int gipGaugeScheduler::getGaugeNum() const {
+    return gauges.size();
+}
+
+int gipGaugeScheduler::getActiveNum() {
+    drainWakes();
+    return active.size();
+}
+
+void gipGaugeScheduler::wake(gipGauge* gauge) {
+    gipGauge::SchedulerBinding& binding = gauge->schedulerbinding;
+    // Already queued, the pending drain will see this data too
+    if (binding.wakequeued.exchange(true, std::memory_order_acq_rel)) return;
+    // Push only, drained all at once by exchange, so there is no ABA hazard
+    gipGauge* head = wakehead.load(std::memory_order_relaxed);
+    do {
+        binding.wakenext.store(head, std::memory_order_relaxed);
+    } while (!wakehead.compare_exchange_weak(head, gauge, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void gipGaugeScheduler::drainWakes() {
+    gipGauge* gauge = wakehead.exchange(nullptr, std::memory_order_acquire);
+    while (gauge) {
+        gipGauge::SchedulerBinding& binding = gauge->schedulerbinding;
+        gipGauge* next = binding.wakenext.load(std::memory_order_relaxed);
+        // Cleared with a read-modify-write before the samples are consumed:
+        // a producer that still saw the flag set has published its value
+        // before, one that sees it cleared queues the gauge again
+        binding.wakequeued.exchange(false, std::memory_order_acq_rel);
+        activate(gauge);
+        gauge = next;
+    }
+}
+
+void gipGaugeScheduler::activate(gipGauge* gauge) {
+    gipGauge::SchedulerBinding& binding = gauge->schedulerbinding;
+    // Late wakes of a detached gauge are dropped
+    if (binding.index < 0 || binding.activeindex >= 0) return;
+    binding.activeindex = active.size();
+    active.push_back(gauge);
+}
+
+void gipGaugeScheduler::deactivate(gipGauge* gauge) {
+    gipGauge::SchedulerBinding& binding = gauge->schedulerbinding;
+    if (binding.activeindex < 0) return;
+    gipGauge* last = active.back();
+    active[binding.activeindex] = last;
+    last->schedulerbinding.activeindex = binding.activeindex;
+    active.pop_back();
+    binding.activeindex = -1;
+}
@@ -0,0 +1,59 @@
+/*
+ * gipGaugeScheduler.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGESCHEDULER_H_
+#define SRC_GIPGAUGESCHEDULER_H_
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+class gipGauge;
+
+// Drives ingestion and animation of the attached gauges, decoupled from
+// drawing. Only gauges in motion are kept in an active list; a settled gauge
+// sleeps until new data wakes it through a lock-free wake list, so the cost
+// of update() scales with the number of changing gauges. Values approach
+// their targets by exponential decay over the real delta time, independent
+// of the frame rate. Gauges bound to telemetry are polled and never sleep.
+//
+// Call update() once per frame on the render thread before drawing. While a
+// gauge is attached its own update() does nothing and draw() only draws.
+class gipGaugeScheduler {
+public:
+    gipGaugeScheduler();
+    virtual ~gipGaugeScheduler();
+
+    // Advances the active gauges by the given delta time in seconds
+    void update(float deltaTime);
+    // Advances the active gauges by the wall-clock time since the previous update
+    void update();
+
+    // Gauge management, normally done through gipGauge::setScheduler()
+    void attach(gipGauge* gauge);
+    void detach(gipGauge* gauge);
+    int getGaugeNum() const;
+    // Gauges stepped by the next update(), including those woken since the last
+    int getActiveNum();
+
+    // Marks a gauge as having new data, safe to call from any thread
+    void wake(gipGauge* gauge);
+
+private:
+    std::vector<gipGauge*> gauges;
+    std::vector<gipGauge*> active;
+    // Intrusive stack of woken gauges, pushed by producers, drained by update()
+    std::atomic<gipGauge*> wakehead;
+
+    std::chrono::steady_clock::time_point lastupdatetime;
+    bool hasupdated;
+
+    void drainWakes();
+    void activate(gipGauge* gauge);
+    void deactivate(gipGauge* gauge);
+};
+
+#endif /* SRC_GIPGAUGESCHEDULER_H_ */
@@ -0,0 +1,295 @@
+/*
+ * gipGaugeStats.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeStats.h"
+#include "gipGaugeBinary.h"
+#include <algorithm>
+#include <cmath>
+
+gipGaugeStats::gipGaugeStats() {
+    window = 256;
+    peakdecay = 0.0f;
+    quantile = 0.95f;
+    allocateQueue(minqueue);
+    allocateQueue(maxqueue);
+    reset();
+}
+
+gipGaugeStats::~gipGaugeStats() {
+}
+
+void gipGaugeStats::allocateQueue(MonotonicQueue& queue) {
+    // A window of N samples never holds more than N candidates
+    int64_t size = 1;
+    while (size < window) size <<= 1;
+    queue.entries.assign(size, Entry());
+    queue.mask = size - 1;
+    queue.head = queue.tail = 0;
+}
+
+void gipGaugeStats::setWindow(int samples) {
+    window = std::max(1, samples);
+    allocateQueue(minqueue);
+    allocateQueue(maxqueue);
+}
+
+int gipGaugeStats::getWindow() const {
+    return window;
+}
+
+void gipGaugeStats::setPeakDecay(float decay) {
+    peakdecay = std::max(0.0f, std::min(1.0f, decay));
+}
+
+float gipGaugeStats::getPeakDecay() const {
+    return peakdecay;
+}
+
+void gipGaugeStats::setQuantile(float newquantile) {
+    quantile = std::max(0.001f, std::min(0.999f, newquantile));
+    // The estimator restarts from the next five samples
+    quantilecount = 0;
+}
+
+float gipGaugeStats::getQuantile() const {
+    return quantile;
+}
+
+void gipGaugeStats::reset() {
+    count = 0;
+    last = 0.0f;
+    minqueue.head = minqueue.tail = 0;
+    maxqueue.head = maxqueue.tail = 0;
+    mean = 0.0;
+    m2 = 0.0;
+    quantilecount = 0;
+    peak = valley = 0.0f;
+    for (int i = 0; i < 5; i++) heights[i] = 0.0f;
+}
+
+void gipGaugeStats::push(float value) {
+    int64_t index = count;
+    count++;
+    last = value;
+
+    // Windowed max. The expired front goes first so the queue never holds
+    // more than window entries, smaller candidates can never become the max.
+    if (maxqueue.tail > maxqueue.head && maxqueue.entries[maxqueue.head & maxqueue.mask].index <= index - window) {
+        maxqueue.head++;
+    }
+    while (maxqueue.tail > maxqueue.head && maxqueue.entries[(maxqueue.tail - 1) & maxqueue.mask].value <= value) {
+        maxqueue.tail--;
+    }
+    maxqueue.entries[maxqueue.tail++ & maxqueue.mask] = {index, value};
+
+    // Windowed min, the mirror image
+    if (minqueue.tail > minqueue.head && minqueue.entries[minqueue.head & minqueue.mask].index <= index - window) {
+        minqueue.head++;
+    }
+    while (minqueue.tail > minqueue.head && minqueue.entries[(minqueue.tail - 1) & minqueue.mask].value >= value) {
+        minqueue.tail--;
+    }
+    minqueue.entries[minqueue.tail++ & minqueue.mask] = {index, value};
+
+    // Welford
+    double delta = value - mean;
+    mean += delta / count;
+    m2 += delta * (value - mean);
+
+    // Peak and valley hold
+    if (count == 1) {
+        peak = valley = value;
+    } else {
+        peak = std::max(value, peak - (peak - value) * peakdecay);
+        valley = std::min(value, valley + (value - valley) * peakdecay);
+    }
+
+    pushQuantile(value);
+}
+
+void gipGaugeStats::holdExtremes(float minValue, float maxValue) {
+    if (count == 0) return;
+    peak = std::max(peak, maxValue);
+    valley = std::min(valley, minValue);
+}
+
+void gipGaugeStats::pushQuantile(float value) {
+    // Collect the first five samples, then run P-square (Jain & Chlamtac)
+    quantilecount++;
+    if (quantilecount <= 5) {
+        heights[quantilecount - 1] = value;
+        if (quantilecount < 5) return;
+        std::sort(heights, heights + 5);
+        for (int i = 0; i < 5; i++) positions[i] = i + 1;
+        desired[0] = 1;
+        desired[1] = 1 + 2 * quantile;
+        desired[2] = 1 + 4 * quantile;
+        desired[3] = 3 + 2 * quantile;
+        desired[4] = 5;
+        increments[0] = 0;
+        increments[1] = quantile / 2;
+        increments[2] = quantile;
+        increments[3] = (1 + quantile) / 2;
+        increments[4] = 1;
+        return;
+    }
+
+    int cell;
+    if (value < heights[0]) {
+        heights[0] = value;
+        cell = 0;
+    } else if (value >= heights[4]) {
+        heights[4] = value;
+        cell = 3;
+    } else {
+        cell = 0;
+        while (cell < 3 && value >= heights[cell + 1]) cell++;
+    }
+
+    for (int i = cell + 1; i < 5; i++) positions[i] += 1;
+    for (int i = 0; i < 5; i++) desired[i] += increments[i];
+
+    // Move the middle markers toward their desired positions
+    for (int i = 1; i < 4; i++) {
+        double offset = desired[i] - positions[i];
+        if ((offset >= 1 && positions[i + 1] - positions[i] > 1) ||
+            (offset <= -1 && positions[i - 1] - positions[i] < -1)) {
+            int d = offset >= 0 ? 1 : -1;
+            float height = parabolic(i, d);
+            if (heights[i - 1] < height && height < heights[i + 1]) heights[i] = height;
+            else heights[i] = linear(i, d);
+            positions[i] += d;
+        }
+    }
+}
+
+float gipGaugeStats::parabolic(int i, int d) const {
+    double np = positions[i + 1] - positions[i];
+    double nm = positions[i] - positions[i - 1];
+    double span = positions[i + 1] - positions[i - 1];
+    return heights[i] + d / span *
+           ((nm + d) * (heights[i + 1] - heights[i]) / np +
+            (np - d) * (heights[i] - heights[i - 1]) / nm);
+}
+
+float gipGaugeStats::linear(int i, int d) const {
+    return heights[i] + d * (heights[i + d] - heights[i]) / (positions[i + d] - positions[i]);
+}
+
+int64_t gipGaugeStats::getSampleNum() const {
+    return count;
+}
+
+float gipGaugeStats::getLast() const {
+    return last;
+}
+
+float gipGaugeStats::getMin() const {
+    if (minqueue.tail == minqueue.head) return 0.0f;
+    return minqueue.entries[minqueue.head & minqueue.mask].value;
+}
+
+float gipGaugeStats::getMax() const {
+    if (maxqueue.tail == maxqueue.head) return 0.0f;
+    return maxqueue.entries[maxqueue.head & maxqueue.mask].value;
+}
+
+float gipGaugeStats::getMean() const {
+    return mean;
+}
+
+float gipGaugeStats::getVariance() const {
+    return count > 1 ? m2 / (count - 1) : 0.0f;
+}
+
+float gipGaugeStats::getStdDev() const {
+    return std::sqrt(getVariance());
+}
+
+float gipGaugeStats::getQuantileValue() const {
+    if (quantilecount == 0) return 0.0f;
+    if (quantilecount >= 5) return heights[2];
+    // Too few samples for the markers, use the exact small-sample quantile
+    int n = static_cast<int>(quantilecount);
+    float sorted[5];
+    for (int i = 0; i < n; i++) {
+        int j = i;
+        for (; j > 0 && sorted[j - 1] > heights[i]; j--) sorted[j] = sorted[j - 1];
+        sorted[j] = heights[i];
+    }
+    return sorted[std::min(n - 1, static_cast<int>(quantile * n))];
+}
+
+float gipGaugeStats::getPeak() const {
+    return peak;
+}
+
+float gipGaugeStats::getValley() const {
+    return valley;
+}
+
+void gipGaugeStats::save(std::vector<uint8_t>& out) const {
+    gipGaugeBinary::append(out, static_cast<int32_t>(window));
+    gipGaugeBinary::append(out, peakdecay);
+    gipGaugeBinary::append(out, quantile);
+    gipGaugeBinary::append(out, count);
+    gipGaugeBinary::append(out, last);
+    gipGaugeBinary::append(out, mean);
+    gipGaugeBinary::append(out, m2);
+    gipGaugeBinary::append(out, quantilecount);
+    gipGaugeBinary::append(out, heights);
+    gipGaugeBinary::append(out, positions);
+    gipGaugeBinary::append(out, desired);
+    gipGaugeBinary::append(out, increments);
+    gipGaugeBinary::append(out, peak);
+    gipGaugeBinary::append(out, valley);
+    const MonotonicQueue* queues[2] = {&minqueue, &maxqueue};
+    for (const MonotonicQueue* queue : queues) {
+        gipGaugeBinary::append(out, queue->head);
+        gipGaugeBinary::append(out, queue->tail);
+        gipGaugeBinary::appendVector(out, queue->entries);
+    }
+}
+
+bool gipGaugeStats::load(const uint8_t*& cursor, const uint8_t* end) {
+    // Parsed into a temporary, the window queues are read with their sizes
+    // bounded by the bytes left instead of being allocated from the window
+    const uint8_t* start = cursor;
+    int32_t newwindow = 0;
+    gipGaugeStats loaded;
+    bool valid = gipGaugeBinary::read(cursor, end, newwindow) && newwindow >= 1 &&
+                 gipGaugeBinary::read(cursor, end, loaded.peakdecay) &&
+                 gipGaugeBinary::read(cursor, end, loaded.quantile) &&
+                 gipGaugeBinary::read(cursor, end, loaded.count) &&
+                 gipGaugeBinary::read(cursor, end, loaded.last) &&
+                 gipGaugeBinary::read(cursor, end, loaded.mean) &&
+                 gipGaugeBinary::read(cursor, end, loaded.m2) &&
+                 gipGaugeBinary::read(cursor, end, loaded.quantilecount) &&
+                 gipGaugeBinary::read(cursor, end, loaded.heights) &&
+                 gipGaugeBinary::read(cursor, end, loaded.positions) &&
+                 gipGaugeBinary::read(cursor, end, loaded.desired) &&
+                 gipGaugeBinary::read(cursor, end, loaded.increments) &&
+                 gipGaugeBinary::read(cursor, end, loaded.peak) &&
+                 gipGaugeBinary::read(cursor, end, loaded.valley);
+    int64_t size = 1;
+    while (valid && size < newwindow) size <<= 1;
+    MonotonicQueue* queues[2] = {&loaded.minqueue, &loaded.maxqueue};
+    for (MonotonicQueue* queue : queues) {
+        valid = valid && gipGaugeBinary::read(cursor, end, queue->head) &&
+                gipGaugeBinary::read(cursor, end, queue->tail) &&
+                gipGaugeBinary::readVector(cursor, end, queue->entries) &&
+                static_cast<int64_t>(queue->entries.size()) == size &&
+                queue->head <= queue->tail && queue->tail - queue->head <= size;
+        queue->mask = size - 1;
+    }
+    if (!valid) {
+        cursor = start;
+        return false;
+    }
+    loaded.window = newwindow;
+    *this = loaded;
+    return true;
+}
@@ -0,0 +1,99 @@
+/*
+ * gipGaugeStats.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGESTATS_H_
+#define SRC_GIPGAUGESTATS_H_
+
+#include <vector>
+#include <cstdint>
+
+// Streaming statistics updated in O(1) per sample, without storing the
+// samples themselves:
+//  - min/max over a sliding window of samples, from monotonic deques
+//  - mean and variance since the last reset, Welford's method
+//  - one quantile (p95 by default) estimated with the P-square algorithm
+//  - peak and valley hold values decaying toward the latest sample
+class gipGaugeStats {
+public:
+    gipGaugeStats();
+    virtual ~gipGaugeStats();
+
+    // Window of the min/max in samples, resets the window state
+    void setWindow(int samples);
+    int getWindow() const;
+    // Fraction of the distance to the latest sample that the peak and valley
+    // give up per sample, 0 holds them until reset()
+    void setPeakDecay(float decay);
+    float getPeakDecay() const;
+    // Estimated quantile in (0, 1), resets the estimator
+    void setQuantile(float quantile);
+    float getQuantile() const;
+
+    void push(float value);
+    // Raises the peak and lowers the valley without counting a sample, for
+    // extremes of a block that was reduced to a single value
+    void holdExtremes(float minValue, float maxValue);
+    void reset();
+
+    int64_t getSampleNum() const;
+    float getLast() const;
+    float getMin() const;
+    float getMax() const;
+    float getMean() const;
+    float getVariance() const;
+    float getStdDev() const;
+    float getQuantileValue() const;
+    float getPeak() const;
+    float getValley() const;
+
+    // Binary snapshot including the window and estimator state. Invalid or
+    // truncated data fails and leaves the statistics unchanged.
+    void save(std::vector<uint8_t>& out) const;
+    bool load(const uint8_t*& cursor, const uint8_t* end);
+
+private:
+    struct Entry {
+        int64_t index;
+        float value;
+    };
+
+    // Fixed-size deque of window candidates, values stay monotonic
+    struct MonotonicQueue {
+        std::vector<Entry> entries;
+        int64_t mask;
+        int64_t head, tail;
+    };
+
+    int window;
+    float peakdecay;
+    float quantile;
+
+    int64_t count;
+    float last;
+    MonotonicQueue minqueue;
+    MonotonicQueue maxqueue;
+
+    // Welford accumulators, double to keep long runs stable
+    double mean;
+    double m2;
+
+    // P-square marker heights, positions and desired positions
+    int64_t quantilecount;
+    float heights[5];
+    double positions[5];
+    double desired[5];
+    double increments[5];
+
+    float peak;
+    float valley;
+
+    void allocateQueue(MonotonicQueue& queue);
+    void pushQuantile(float value);
+    float parabolic(int i, int d) const;
+    float linear(int i, int d) const;
+};
+
+#endif /* SRC_GIPGAUGESTATS_H_ */
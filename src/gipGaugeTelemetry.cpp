@@ -0,0 +1,239 @@
+/*
+ * gipGaugeTelemetry.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTelemetry.h"
+#include <chrono>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define GIPGAUGE_TELEMETRY_MMAP 1
+#endif
+
+// Writer and readers share CLOCK_MONOTONIC through the steady clock on Linux
+static int64_t getSteadyNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static const int readretries = 4;
+
+gipGaugeTelemetry::gipGaugeTelemetry() {
+    header = nullptr;
+    sequences = nullptr;
+    values = nullptr;
+    mappedsize = 0;
+    writable = false;
+    staletimeout = 1.0f;
+}
+
+gipGaugeTelemetry::~gipGaugeTelemetry() {
+    close();
+}
+
+bool gipGaugeTelemetry::open(const std::string& path) {
+    return map(path, false, 0);
+}
+
+bool gipGaugeTelemetry::map(const std::string& path, bool create, int slotcount) {
+    close();
+#ifdef GIPGAUGE_TELEMETRY_MMAP
+    int fd = create ? ::open(path.c_str(), O_RDWR | O_CREAT, 0644) : ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+    size_t size = info.st_size;
+    bool fresh = create && size == 0;
+    if (fresh) {
+        // Only an empty file is sized, readers cannot have mapped it yet
+        size = getSegmentSize(slotcount);
+        if (ftruncate(fd, size) != 0) {
+            ::close(fd);
+            return false;
+        }
+    } else if (size < sizeof(Header)) {
+        ::close(fd);
+        return false;
+    }
+
+    int protection = create ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* address = mmap(nullptr, size, protection, MAP_SHARED, fd, 0);
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+    if (address == MAP_FAILED) return false;
+
+    header = static_cast<Header*>(address);
+    mappedsize = size;
+    writable = create;
+
+    if (fresh) {
+        header->magic.store(0, std::memory_order_relaxed);
+        header->version = VERSION;
+        header->slotcount = slotcount;
+        header->headersize = sizeof(Header);
+        header->sequence.store(0, std::memory_order_relaxed);
+        header->heartbeat.store(0, std::memory_order_relaxed);
+        mapArrays();
+        for (int i = 0; i < slotcount; i++) {
+            sequences[i].store(0, std::memory_order_relaxed);
+            values[i].store(0.0f, std::memory_order_relaxed);
+        }
+        header->magic.store(MAGIC, std::memory_order_release);
+        return true;
+    }
+
+    bool valid = header->magic.load(std::memory_order_acquire) == MAGIC && header->version == VERSION &&
+                 header->headersize == sizeof(Header) &&
+                 mappedsize >= getSegmentSize(header->slotcount);
+    if (create) valid = valid && header->slotcount == static_cast<uint32_t>(slotcount);
+    if (!valid) {
+        close();
+        return false;
+    }
+
+    mapArrays();
+    if (create) {
+        // Taking over a live segment, readers see absent until the first beat,
+        // never a torn or shrunk segment. Values are not rewritten, so bound
+        // gauges record nothing until the new writer writes. A slot the
+        // previous writer died in the middle of is completed as it stands.
+        header->heartbeat.store(0, std::memory_order_release);
+        for (int i = 0; i < slotcount; i++) {
+            uint32_t sequence = sequences[i].load(std::memory_order_relaxed);
+            if (sequence & 1) sequences[i].store(sequence + 1, std::memory_order_release);
+        }
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t gipGaugeTelemetry::getSegmentSize(uint32_t slotcount) {
+    return sizeof(Header) + (sizeof(std::atomic<uint32_t>) + sizeof(std::atomic<float>)) * slotcount;
+}
+
+void gipGaugeTelemetry::mapArrays() {
+    char* base = reinterpret_cast<char*>(header) + sizeof(Header);
+    sequences = reinterpret_cast<std::atomic<uint32_t>*>(base);
+    values = reinterpret_cast<std::atomic<float>*>(base + sizeof(std::atomic<uint32_t>) * header->slotcount);
+}
+
+void gipGaugeTelemetry::writeSlot(int slot, float value) {
+    uint32_t sequence = sequences[slot].load(std::memory_order_relaxed);
+    sequences[slot].store(sequence + 1, std::memory_order_relaxed);
+    // A reader that acquires the new value also sees the odd sequence
+    values[slot].store(value, std::memory_order_release);
+    sequences[slot].store(sequence + 2, std::memory_order_release);
+}
+
+void gipGaugeTelemetry::close() {
+#ifdef GIPGAUGE_TELEMETRY_MMAP
+    if (header) munmap(header, mappedsize);
+#endif
+    header = nullptr;
+    sequences = nullptr;
+    values = nullptr;
+    mappedsize = 0;
+    writable = false;
+}
+
+bool gipGaugeTelemetry::isOpen() const {
+    return header != nullptr;
+}
+
+int gipGaugeTelemetry::getSlotNum() const {
+    return header ? header->slotcount : 0;
+}
+
+void gipGaugeTelemetry::setStaleTimeout(float seconds) {
+    staletimeout = seconds > 0.0f ? seconds : 0.0f;
+}
+
+float gipGaugeTelemetry::getStaleTimeout() const {
+    return staletimeout;
+}
+
+gipGaugeTelemetry::Status gipGaugeTelemetry::getStatus() const {
+    float age = getWriterAge();
+    if (age < 0.0f) return STATUS_ABSENT;
+    if (age > staletimeout) return STATUS_STALE;
+    return STATUS_OK;
+}
+
+gipGaugeTelemetry::Status gipGaugeTelemetry::read(int slot, float& value, uint32_t* sequence) const {
+    if (header == nullptr || slot < 0 || slot >= static_cast<int>(header->slotcount)) return STATUS_ABSENT;
+    Status status = getStatus();
+    if (status != STATUS_OK) return status;
+
+    for (int i = 0; i < readretries; i++) {
+        uint32_t before = sequences[slot].load(std::memory_order_acquire);
+        if (before & 1) continue;
+        // Acquire keeps the second sequence load after the value load
+        float candidate = values[slot].load(std::memory_order_acquire);
+        if (sequences[slot].load(std::memory_order_relaxed) != before) continue;
+        value = candidate;
+        if (sequence) *sequence = before;
+        return STATUS_OK;
+    }
+    return STATUS_BUSY;
+}
+
+uint32_t gipGaugeTelemetry::getSequence() const {
+    return header ? header->sequence.load(std::memory_order_acquire) & ~1u : 0;
+}
+
+float gipGaugeTelemetry::getWriterAge() const {
+    if (header == nullptr) return -1.0f;
+    int64_t beat = header->heartbeat.load(std::memory_order_acquire);
+    if (beat == 0) return -1.0f;
+    return (getSteadyNanoseconds() - beat) * 1e-9f;
+}
+
+gipGaugeTelemetryWriter::gipGaugeTelemetryWriter() {
+}
+
+gipGaugeTelemetryWriter::~gipGaugeTelemetryWriter() {
+}
+
+bool gipGaugeTelemetryWriter::create(const std::string& path, int slotcount) {
+    return map(path, true, slotcount > 0 ? slotcount : 0);
+}
+
+void gipGaugeTelemetryWriter::beginWrite() {
+    if (!writable) return;
+    uint32_t sequence = header->sequence.load(std::memory_order_relaxed);
+    header->sequence.store(sequence + 1, std::memory_order_relaxed);
+}
+
+void gipGaugeTelemetryWriter::setValue(int slot, float value) {
+    if (!writable || slot < 0 || slot >= static_cast<int>(header->slotcount)) return;
+    writeSlot(slot, value);
+}
+
+void gipGaugeTelemetryWriter::endWrite() {
+    if (!writable) return;
+    uint32_t sequence = header->sequence.load(std::memory_order_relaxed);
+    header->sequence.store(sequence + 1, std::memory_order_release);
+    heartbeat();
+}
+
+void gipGaugeTelemetryWriter::write(const float* newvalues, int count, int firstSlot) {
+    beginWrite();
+    for (int i = 0; i < count; i++) setValue(firstSlot + i, newvalues[i]);
+    endWrite();
+}
+
+void gipGaugeTelemetryWriter::heartbeat() {
+    if (!writable) return;
+    header->heartbeat.store(getSteadyNanoseconds(), std::memory_order_release);
+}
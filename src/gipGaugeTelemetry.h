@@ -0,0 +1,113 @@
+/*
+ * gipGaugeTelemetry.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGETELEMETRY_H_
+#define SRC_GIPGAUGETELEMETRY_H_
+
+#include <atomic>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+// Memory-mapped telemetry segment: a small header followed by an array of
+// slot sequences and an array of float values, so a frame of values is one
+// contiguous block. A single writer process updates each slot under its own
+// seqlock and
+// beats a heartbeat; gauges bound to a slot read it straight from the mapping
+// in update(), without copies or syscalls. A slot's sequence only moves when
+// that slot is written, so a gauge records exactly the writes to its slot.
+// Memory mapping is POSIX only, open() and create() fail on other platforms.
+class gipGaugeTelemetry {
+public:
+    enum Status {
+        STATUS_OK = 0,
+        STATUS_STALE,   // Writer has not beaten within the stale timeout
+        STATUS_ABSENT,  // No valid segment, or the writer never started
+        STATUS_BUSY     // Writer kept the slot sequence odd through every retry
+    };
+
+    // Shared layout, identical in the writer and the readers
+    // Published last, readers ignore the segment until it is set
+    struct Header {
+        std::atomic<uint32_t> magic;
+        uint32_t version;
+        uint32_t slotcount;
+        uint32_t headersize;
+        alignas(64) std::atomic<uint32_t> sequence;     // Frame count, odd while writing a frame
+        alignas(64) std::atomic<int64_t> heartbeat;     // Steady clock, ns
+    };
+
+    static const uint32_t MAGIC = 0x54504947;  // "GIPT"
+    static const uint32_t VERSION = 3;
+
+    gipGaugeTelemetry();
+    virtual ~gipGaugeTelemetry();
+
+    // Maps an existing segment read-only
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const;
+    int getSlotNum() const;
+
+    // Writer has to beat at least this often, in seconds
+    void setStaleTimeout(float seconds);
+    float getStaleTimeout() const;
+
+    // Seqlock read of one slot, retried a few times if the writer is busy.
+    // The value and the slot sequence it was read at are only written on
+    // STATUS_OK. The slot sequence changes exactly when the slot is written.
+    Status read(int slot, float& value, uint32_t* sequence = nullptr) const;
+    // Number of completed frames times two, see beginWrite()
+    uint32_t getSequence() const;
+    // Seconds since the last heartbeat, negative if the writer never beat
+    float getWriterAge() const;
+    Status getStatus() const;
+
+protected:
+    Header* header;
+    std::atomic<uint32_t>* sequences;   // Per slot, odd while it is written
+    std::atomic<float>* values;
+    size_t mappedsize;
+    bool writable;
+    float staletimeout;
+
+    bool map(const std::string& path, bool create, int slotcount);
+    static size_t getSegmentSize(uint32_t slotcount);
+    // Points sequences and values into the mapping behind the header
+    void mapArrays();
+    // Seqlock write of one slot, writer side only
+    void writeSlot(int slot, float value);
+
+private:
+    gipGaugeTelemetry(const gipGaugeTelemetry&) = delete;
+    gipGaugeTelemetry& operator=(const gipGaugeTelemetry&) = delete;
+};
+
+// Writer side, meant for the acquisition process. Either write a whole frame
+// with write(), or wrap setValue() calls in beginWrite()/endWrite().
+class gipGaugeTelemetryWriter : public gipGaugeTelemetry {
+public:
+    gipGaugeTelemetryWriter();
+    virtual ~gipGaugeTelemetryWriter();
+
+    // Creates the segment file and maps it read-write. An existing segment
+    // with the same slot count is taken over and never resized, so readers
+    // that still map it stay valid. Its values are kept and read as absent
+    // until the first heartbeat; only a slot left mid-write by a crashed
+    // writer gets its sequence completed. Any other existing file is left
+    // alone and fails.
+    bool create(const std::string& path, int slotcount);
+
+    // Frame markers, each setValue() is published on its own
+    void beginWrite();
+    void setValue(int slot, float value);
+    void endWrite();
+    void write(const float* newvalues, int count, int firstSlot = 0);
+    // Marks the writer alive without changing values, endWrite() also beats
+    void heartbeat();
+};
+
+#endif /* SRC_GIPGAUGETELEMETRY_H_ */
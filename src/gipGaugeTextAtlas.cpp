@@ -0,0 +1,300 @@
+/*
+ * gipGaugeTextAtlas.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTextAtlas.h"
+#include "gRenderer.h"
+#include <algorithm>
+#include <cstring>
+
+// Characters of a value readout, rasterized once per font size
+static const char glyphchars[] = "0123456789-+.";
+static const int glyphcount = sizeof(glyphchars) - 1;
+
+gipGaugeTextAtlas::gipGaugeTextAtlas(int atlasWidth, int atlasHeight) {
+    width = atlasWidth;
+    height = atlasHeight;
+    maxpages = 4;
+    frame = 0;
+}
+
+gipGaugeTextAtlas::~gipGaugeTextAtlas() {
+}
+
+gipGaugeTextAtlas* gipGaugeTextAtlas::getShared() {
+    static gipGaugeTextAtlas sharedatlas;
+    return &sharedatlas;
+}
+
+void gipGaugeTextAtlas::beginFrame() {
+    frame++;
+}
+
+void gipGaugeTextAtlas::setMaxPages(int newmaxpages) {
+    maxpages = std::max(1, newmaxpages);
+}
+
+int gipGaugeTextAtlas::getMaxPages() const {
+    return maxpages;
+}
+
+int gipGaugeTextAtlas::getPageNum() const {
+    return pages.size();
+}
+
+void gipGaugeTextAtlas::setFontMetrics(int fontSize, int charWidth, int lineHeight) {
+    FontMetrics& font = metrics[fontSize];
+    font.charwidth = std::max(1, charWidth);
+    font.lineheight = std::max(1, lineHeight);
+    // Slots of this size were laid out with the old metrics
+    forgetFont(fontSize);
+}
+
+int gipGaugeTextAtlas::getCharWidth(int fontSize) const {
+    std::map<int, FontMetrics>::const_iterator it = metrics.find(fontSize);
+    if (it != metrics.end()) return it->second.charwidth;
+    return 7 + fontSize * 2;  // Conservative estimate until metrics are set
+}
+
+int gipGaugeTextAtlas::getLineHeight(int fontSize) const {
+    std::map<int, FontMetrics>::const_iterator it = metrics.find(fontSize);
+    if (it != metrics.end()) return it->second.lineheight;
+    return 14 + fontSize * 4;
+}
+
+void gipGaugeTextAtlas::setGlyphAdvance(int fontSize, char c, int advance) {
+    std::map<int, FontMetrics>::iterator it = metrics.find(fontSize);
+    if (it == metrics.end()) {
+        it = metrics.insert({fontSize, {getCharWidth(fontSize), getLineHeight(fontSize), {}}}).first;
+    }
+    std::vector<int>& advances = it->second.advances;
+    if (advances.empty()) advances.assign(256, it->second.charwidth);
+    advances[static_cast<unsigned char>(c)] = std::max(0, advance);
+    forgetFont(fontSize);
+}
+
+int gipGaugeTextAtlas::getGlyphAdvance(int fontSize, char c) const {
+    std::map<int, FontMetrics>::const_iterator it = metrics.find(fontSize);
+    if (it == metrics.end()) return getCharWidth(fontSize);
+    if (it->second.advances.empty()) return it->second.charwidth;
+    return it->second.advances[static_cast<unsigned char>(c)];
+}
+
+int gipGaugeTextAtlas::getTextWidth(const std::string& text, int fontSize) const {
+    std::map<int, FontMetrics>::const_iterator it = metrics.find(fontSize);
+    if (it == metrics.end() || it->second.advances.empty()) return text.size() * getCharWidth(fontSize);
+    int textwidth = 0;
+    for (char c : text) textwidth += it->second.advances[static_cast<unsigned char>(c)];
+    return textwidth;
+}
+
+int gipGaugeTextAtlas::getAscent(int fontSize) const {
+    return getLineHeight(fontSize) * 4 / 5;
+}
+
+bool gipGaugeTextAtlas::isGlyph(char c) {
+    return c != '\0' && std::strchr(glyphchars, c) != nullptr;
+}
+
+int gipGaugeTextAtlas::getLabelNum() const {
+    int count = 0;
+    for (const auto& font : labels) count += font.second.size();
+    return count;
+}
+
+void gipGaugeTextAtlas::clear() {
+    labels.clear();
+    glyphs.clear();
+    pending.clear();
+    pages.clear();
+}
+
+void gipGaugeTextAtlas::forgetFont(int fontSize) {
+    // Their slots stay allocated until the page is evicted, nothing else moves
+    labels.erase(fontSize);
+    glyphs.erase(fontSize);
+    pending.erase(std::remove_if(pending.begin(), pending.end(),
+            [fontSize](const Pending& item) { return item.fontsize == fontSize; }), pending.end());
+}
+
+bool gipGaugeTextAtlas::allocateOnPage(Page& page, int w, int h, Region& region) {
+    // Shelf packing, labels of one font size share a row height
+    int shelfx = page.shelfx;
+    int shelfy = page.shelfy;
+    int shelfheight = page.shelfheight;
+    if (shelfx + w > width) {
+        shelfy += shelfheight;
+        shelfx = 0;
+        shelfheight = 0;
+    }
+    if (shelfy + h > height) return false;
+    region.x = shelfx;
+    region.y = shelfy;
+    region.w = w;
+    region.h = h;
+    page.shelfx = shelfx + w;
+    page.shelfy = shelfy;
+    page.shelfheight = std::max(shelfheight, h);
+    page.lastused = frame;
+    return true;
+}
+
+bool gipGaugeTextAtlas::allocateRegion(int w, int h, Region& region) {
+    if (w > width || h > height) return false;
+    // Newest page first, older ones only have scraps left at their end
+    for (int p = pages.size() - 1; p >= 0; p--) {
+        if (allocateOnPage(*pages[p], w, h, region)) {
+            region.page = p;
+            return true;
+        }
+    }
+
+    int page = -1;
+    if (static_cast<int>(pages.size()) < maxpages) {
+        page = pages.size();
+        pages.emplace_back(new Page());
+        pages.back()->allocated = false;
+    } else {
+        // Least recently used page, never one drawn from this frame
+        for (size_t p = 0; p < pages.size(); p++) {
+            if (pages[p]->lastused >= frame) continue;
+            if (page < 0 || pages[p]->lastused < pages[page]->lastused) page = p;
+        }
+        if (page < 0) return false;
+        evictPage(page);
+    }
+    Page& target = *pages[page];
+    target.shelfx = target.shelfy = target.shelfheight = 0;
+    if (!allocateOnPage(target, w, h, region)) return false;
+    region.page = page;
+    return true;
+}
+
+void gipGaugeTextAtlas::evictPage(int index) {
+    for (auto& font : labels) {
+        std::unordered_map<std::string, Region>& fontlabels = font.second;
+        for (auto it = fontlabels.begin(); it != fontlabels.end();) {
+            if (it->second.page == index) it = fontlabels.erase(it);
+            else ++it;
+        }
+    }
+    // A strip is only usable whole
+    for (auto it = glyphs.begin(); it != glyphs.end();) {
+        bool onpage = false;
+        for (const Region& glyph : it->second) onpage = onpage || glyph.page == index;
+        if (onpage) it = glyphs.erase(it);
+        else ++it;
+    }
+    pending.erase(std::remove_if(pending.begin(), pending.end(),
+            [index](const Pending& item) { return item.region.page == index; }), pending.end());
+    // Reallocate on the next rasterization so stale pixels don't bleed into
+    // new slots. The page was not drawn from this frame.
+    pages[index]->allocated = false;
+}
+
+const gipGaugeTextAtlas::Region* gipGaugeTextAtlas::findLabel(const std::string& text, int fontSize) {
+    std::unordered_map<std::string, Region>& fontlabels = labels[fontSize];
+    std::unordered_map<std::string, Region>::const_iterator it = fontlabels.find(text);
+    if (it != fontlabels.end()) {
+        pages[it->second.page]->lastused = frame;
+        return &it->second;
+    }
+
+    Region region;
+    int w = getTextWidth(text, fontSize) + 2;
+    if (!allocateRegion(w, getLineHeight(fontSize), region)) return nullptr;
+    pending.push_back({text, fontSize, region});
+    return &(fontlabels[text] = region);
+}
+
+const std::vector<gipGaugeTextAtlas::Region>* gipGaugeTextAtlas::findGlyphs(int fontSize) {
+    std::map<int, std::vector<Region>>::const_iterator it = glyphs.find(fontSize);
+    if (it != glyphs.end()) {
+        for (const Region& glyph : it->second) pages[glyph.page]->lastused = frame;
+        return &it->second;
+    }
+
+    std::vector<Region> strip(glyphcount);
+    int h = getLineHeight(fontSize);
+    for (int i = 0; i < glyphcount; i++) {
+        // Slots allocated so far are stamped with this frame and survive
+        int w = std::max(1, getGlyphAdvance(fontSize, glyphchars[i]));
+        if (!allocateRegion(w, h, strip[i])) return nullptr;
+    }
+    for (int i = 0; i < glyphcount; i++) {
+        pending.push_back({std::string(1, glyphchars[i]), fontSize, strip[i]});
+    }
+    return &(glyphs[fontSize] = strip);
+}
+
+void gipGaugeTextAtlas::rasterizePending() {
+    if (pending.empty()) return;
+    renderer->setColor(gColor(1.0f, 1.0f, 1.0f, 1.0f));
+    for (size_t p = 0; p < pages.size(); p++) {
+        Page& page = *pages[p];
+        bool bound = false;
+        for (const Pending& item : pending) {
+            if (item.region.page != static_cast<int>(p)) continue;
+            if (!page.allocated) {
+                page.fbo.allocate(width, height);
+                page.allocated = true;
+            }
+            if (!bound) {
+                page.fbo.bind();
+                bound = true;
+            }
+            renderer->drawText(item.text, item.region.x, item.region.y + getAscent(item.fontsize), item.fontsize);
+        }
+        if (bound) page.fbo.unbind();
+    }
+    pending.clear();
+}
+
+void gipGaugeTextAtlas::blit(const Region& region, float x, float y, int fontSize) {
+    // Text is positioned by its baseline, regions by their top-left corner
+    int top = static_cast<int>(y) - getAscent(fontSize);
+    pages[region.page]->fbo.getTexture().drawSub(static_cast<int>(x), top, region.w, region.h,
+                                                 region.x, region.y, region.w, region.h);
+}
+
+void gipGaugeTextAtlas::drawLabel(const std::string& text, float x, float y, int fontSize, const gColor& color) {
+    if (text.empty()) return;
+    const Region* region = findLabel(text, fontSize);
+    if (region == nullptr) {
+        renderer->drawText(text, x, y, fontSize);
+        return;
+    }
+    Region slot = *region;
+    if (!pending.empty()) {
+        rasterizePending();
+        renderer->setColor(color);
+    }
+    blit(slot, x, y, fontSize);
+}
+
+void gipGaugeTextAtlas::drawValue(const std::string& text, float x, float y, int fontSize, const gColor& color) {
+    const std::vector<Region>* strip = findGlyphs(fontSize);
+    if (strip == nullptr) {
+        renderer->drawText(text, x, y, fontSize);
+        return;
+    }
+    if (!pending.empty()) {
+        rasterizePending();
+        renderer->setColor(color);
+    }
+
+    size_t i = 0;
+    for (; i < text.size() && isGlyph(text[i]); i++) {
+        const char* found = std::strchr(glyphchars, text[i]);
+        blit((*strip)[found - glyphchars], x, y, fontSize);
+        x += getGlyphAdvance(fontSize, text[i]);
+    }
+
+    // The unit suffix is static, draw it as a cached label
+    if (i < text.size()) {
+        suffix.assign(text, i, std::string::npos);
+        drawLabel(suffix, x, y, fontSize, color);
+    }
+}
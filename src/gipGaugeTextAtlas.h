@@ -0,0 +1,112 @@
+/*
+ * gipGaugeTextAtlas.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGETEXTATLAS_H_
+#define SRC_GIPGAUGETEXTATLAS_H_
+
+#include "gFbo.h"
+#include "gColor.h"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <string>
+#include <vector>
+
+// Shared cache of pre-rasterized text. Every distinct static label (tick
+// labels, titles, units) is rasterized once into an offscreen atlas, and the
+// characters of value readouts come from a per-font-size glyph strip, so text
+// is drawn as textured quads instead of being laid out every frame. Gauges
+// with the same range share the same label regions.
+//
+// The atlas is split into pages of the constructor size. A full atlas adds a
+// page, up to the page limit, and then evicts the least recently used page
+// that was not drawn from in the current frame, so text already drawn this
+// frame is never invalidated. Text that fits nowhere is drawn directly.
+class gipGaugeTextAtlas {
+public:
+    struct Region {
+        int page;
+        int x, y, w, h;
+    };
+
+    gipGaugeTextAtlas(int width = 1024, int height = 1024);
+    virtual ~gipGaugeTextAtlas();
+
+    // Process-wide atlas, so gauges with identical ranges share label regions
+    static gipGaugeTextAtlas* getShared();
+
+    // Call once per frame before drawing. Pages are only evicted once a frame
+    // has passed since they were last drawn from, without calls they only grow.
+    void beginFrame();
+    void setMaxPages(int pages);
+    int getMaxPages() const;
+    int getPageNum() const;
+
+    // Cell metrics used to size atlas slots, in pixels. Without glyph
+    // advances every character advances by charWidth.
+    void setFontMetrics(int fontSize, int charWidth, int lineHeight);
+    int getCharWidth(int fontSize) const;
+    int getLineHeight(int fontSize) const;
+    // Advance of one character of a proportional font, e.g. measured with
+    // gFont::getStringWidth(). Labels are laid out and measured by the sum.
+    void setGlyphAdvance(int fontSize, char c, int advance);
+    int getGlyphAdvance(int fontSize, char c) const;
+    int getTextWidth(const std::string& text, int fontSize) const;
+
+    // Draws a whole string from its cached label region. The color is only
+    // reapplied when rasterizing new text had to change the renderer color.
+    void drawLabel(const std::string& text, float x, float y, int fontSize, const gColor& color);
+    // Draws glyph strip characters one by one, falls back to labels for the rest
+    void drawValue(const std::string& text, float x, float y, int fontSize, const gColor& color);
+
+    static bool isGlyph(char c);
+    int getLabelNum() const;
+    // Drops every page, only call between frames
+    void clear();
+
+private:
+    struct FontMetrics {
+        int charwidth;
+        int lineheight;
+        std::vector<int> advances;      // Per character, empty while monospace
+    };
+
+    struct Page {
+        gFbo fbo;
+        bool allocated;
+        int shelfx, shelfy, shelfheight;
+        uint64_t lastused;              // Frame of the last draw or allocation
+    };
+
+    struct Pending {
+        std::string text;
+        int fontsize;
+        Region region;
+    };
+
+    std::vector<std::unique_ptr<Page>> pages;
+    int maxpages;
+    uint64_t frame;
+    int width, height;
+    std::map<int, FontMetrics> metrics;
+    std::map<int, std::unordered_map<std::string, Region>> labels;
+    std::map<int, std::vector<Region>> glyphs;
+    std::vector<Pending> pending;
+    std::string suffix;
+
+    const Region* findLabel(const std::string& text, int fontSize);
+    const std::vector<Region>* findGlyphs(int fontSize);
+    bool allocateRegion(int w, int h, Region& region);
+    bool allocateOnPage(Page& page, int w, int h, Region& region);
+    void evictPage(int index);
+    void forgetFont(int fontSize);
+    void rasterizePending();
+    void blit(const Region& region, float x, float y, int fontSize);
+    int getAscent(int fontSize) const;
+};
+
+#endif /* SRC_GIPGAUGETEXTATLAS_H_ */
@@ -0,0 +1,126 @@
+/*
+ * gipGaugeThreadPool.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeThreadPool.h"
+#include <algorithm>
+
+gipGaugeThreadPool::gipGaugeThreadPool(int workers) {
+    if (workers <= 0) workers = std::max(0, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+    generation = 0;
+    stopping = false;
+    remaining = 0;
+    failed = false;
+    for (int i = 0; i <= workers; i++) queues.emplace_back(new Queue());
+    for (int i = 0; i < workers; i++) threads.emplace_back(&gipGaugeThreadPool::workerLoop, this, i);
+}
+
+gipGaugeThreadPool::~gipGaugeThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& thread : threads) thread.join();
+}
+
+int gipGaugeThreadPool::getThreadNum() const {
+    return queues.size();
+}
+
+void gipGaugeThreadPool::parallelFor(int count, const std::function<void(int)>& body, int grain) {
+    if (count <= 0) return;
+    grain = std::max(1, grain);
+    if (threads.empty() || count <= grain) {
+        for (int i = 0; i < count; i++) body(i);
+        return;
+    }
+
+    std::lock_guard<std::mutex> run(runmutex);
+    // Deal the chunks round-robin, every queue starts with a similar share
+    int chunks = (count + grain - 1) / grain;
+    remaining = chunks;
+    failed = false;
+    for (int c = 0; c < chunks; c++) {
+        Queue& queue = *queues[c % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back({c * grain, std::min(count, (c + 1) * grain), &body});
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        generation++;
+    }
+    wake.notify_all();
+
+    // Help, then wait for the chunks still running on workers
+    runTasks(queues.size() - 1);
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this]() { return remaining.load() == 0; });
+    if (error) {
+        std::exception_ptr thrown = error;
+        error = nullptr;
+        std::rethrow_exception(thrown);
+    }
+}
+
+void gipGaugeThreadPool::workerLoop(int index) {
+    uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&]() { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+        runTasks(index);
+    }
+}
+
+void gipGaugeThreadPool::runTasks(int index) {
+    Task task;
+    while (popTask(index, task)) {
+        // Every chunk is counted down, even skipped or failed ones, or the
+        // caller would wait forever
+        if (!failed.load(std::memory_order_relaxed)) {
+            try {
+                for (int i = task.begin; i < task.end; i++) (*task.body)(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) error = std::current_exception();
+                failed = true;
+            }
+        }
+        if (remaining.fetch_sub(1) == 1) {
+            // Taking the lock orders the notify after the waiter's check
+            std::lock_guard<std::mutex> lock(mutex);
+            done.notify_all();
+        }
+    }
+}
+
+bool gipGaugeThreadPool::popTask(int index, Task& task) {
+    // Own queue from the back, the most recently dealt and still cache-warm
+    {
+        Queue& own = *queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = own.tasks.back();
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+    // Steal from the front of the others, starting at the next neighbor
+    int num = queues.size();
+    for (int i = 1; i < num; i++) {
+        Queue& victim = *queues[(index + i) % num];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
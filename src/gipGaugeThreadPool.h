@@ -0,0 +1,71 @@
+/*
+ * gipGaugeThreadPool.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGETHREADPOOL_H_
+#define SRC_GIPGAUGETHREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Small work-stealing pool for data-parallel loops. Each worker owns a queue
+// of index ranges and takes from its back; a worker running dry steals from
+// the front of the others, so uneven tasks, such as gauges with very
+// different tick counts, still balance. The calling thread works along.
+class gipGaugeThreadPool {
+public:
+    // 0 or less starts one worker per hardware thread besides the caller
+    gipGaugeThreadPool(int workers = 0);
+    virtual ~gipGaugeThreadPool();
+
+    // Workers plus the calling thread
+    int getThreadNum() const;
+
+    // Calls body(index) for every index in [0, count) and returns when all
+    // calls have finished. Indices are handed out in chunks of grain. Calls
+    // from several threads at once are serialized. If body throws, chunks
+    // not yet started are skipped and the first exception is rethrown here
+    // once the running ones have finished.
+    void parallelFor(int count, const std::function<void(int)>& body, int grain = 1);
+
+private:
+    struct Task {
+        int begin, end;
+        const std::function<void(int)>* body;
+    };
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::thread> threads;
+    // One queue per worker, the last one belongs to the calling thread
+    std::vector<std::unique_ptr<Queue>> queues;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    uint64_t generation;
+    bool stopping;
+    std::atomic<int> remaining;
+    // First exception thrown by body in the current loop, guarded by mutex
+    std::exception_ptr error;
+    std::atomic<bool> failed;
+    std::mutex runmutex;
+
+    void workerLoop(int index);
+    void runTasks(int index);
+    bool popTask(int index, Task& task);
+};
+
+#endif /* SRC_GIPGAUGETHREADPOOL_H_ */
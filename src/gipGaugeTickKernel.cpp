@@ -0,0 +1,114 @@
+/*
+ * gipGaugeTickKernel.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTickKernel.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define GIPGAUGE_TICKKERNEL_SSE 1
+#endif
+
+void gipGaugeTickArrays::clear() {
+    x1.clear();
+    y1.clear();
+    x2.clear();
+    y2.clear();
+}
+
+int gipGaugeTickArrays::size() const {
+    return x1.size();
+}
+
+void gipGaugeTickKernel::directions(double startAngle, double stepAngle, int count, float* cosines, float* sines) {
+    const double torad = M_PI / 180.0;
+    double stepcos = std::cos(stepAngle * torad);
+    double stepsin = std::sin(stepAngle * torad);
+
+    int i = 0;
+#ifdef GIPGAUGE_TICKKERNEL_SSE
+    if (count >= 4) {
+        // Lanes hold four consecutive ticks and advance by four steps at once
+        double quadcos = std::cos(4.0 * stepAngle * torad);
+        double quadsin = std::sin(4.0 * stepAngle * torad);
+        __m128 rc = _mm_set1_ps(static_cast<float>(quadcos));
+        __m128 rs = _mm_set1_ps(static_cast<float>(quadsin));
+        int vectorend = count & ~3;
+        while (i < vectorend) {
+            // Exact seed for lane 0, the other lanes are one double step apart
+            float seedcos[4], seedsin[4];
+            double c = std::cos((startAngle + i * stepAngle) * torad);
+            double s = std::sin((startAngle + i * stepAngle) * torad);
+            for (int k = 0; k < 4; k++) {
+                seedcos[k] = static_cast<float>(c);
+                seedsin[k] = static_cast<float>(s);
+                double next = c * stepcos - s * stepsin;
+                s = s * stepcos + c * stepsin;
+                c = next;
+            }
+            __m128 vc = _mm_loadu_ps(seedcos);
+            __m128 vs = _mm_loadu_ps(seedsin);
+            int end = std::min(vectorend, i + RESEED_INTERVAL);
+            for (; i < end; i += 4) {
+                _mm_storeu_ps(cosines + i, vc);
+                _mm_storeu_ps(sines + i, vs);
+                __m128 next = _mm_sub_ps(_mm_mul_ps(vc, rc), _mm_mul_ps(vs, rs));
+                vs = _mm_add_ps(_mm_mul_ps(vs, rc), _mm_mul_ps(vc, rs));
+                vc = next;
+            }
+        }
+    }
+#endif
+    // Scalar recurrence in double for the tail, or for everything without SSE2
+    while (i < count) {
+        double c = std::cos((startAngle + i * stepAngle) * torad);
+        double s = std::sin((startAngle + i * stepAngle) * torad);
+        int end = std::min(count, i + RESEED_INTERVAL);
+        for (; i < end; i++) {
+            cosines[i] = static_cast<float>(c);
+            sines[i] = static_cast<float>(s);
+            double next = c * stepcos - s * stepsin;
+            s = s * stepcos + c * stepsin;
+            c = next;
+        }
+    }
+}
+
+void gipGaugeTickKernel::endpoints(const float* cosines, const float* sines, int count,
+                                   float centerX, float centerY, float innerRadius, float outerRadius, gipGaugeTickArrays& out) {
+    int offset = out.size();
+    out.x1.resize(offset + count);
+    out.y1.resize(offset + count);
+    out.x2.resize(offset + count);
+    out.y2.resize(offset + count);
+    float* x1 = out.x1.data() + offset;
+    float* y1 = out.y1.data() + offset;
+    float* x2 = out.x2.data() + offset;
+    float* y2 = out.y2.data() + offset;
+
+    int i = 0;
+#ifdef GIPGAUGE_TICKKERNEL_SSE
+    __m128 cx = _mm_set1_ps(centerX);
+    __m128 cy = _mm_set1_ps(centerY);
+    __m128 inner = _mm_set1_ps(innerRadius);
+    __m128 outer = _mm_set1_ps(outerRadius);
+    for (; i + 4 <= count; i += 4) {
+        __m128 c = _mm_loadu_ps(cosines + i);
+        __m128 s = _mm_loadu_ps(sines + i);
+        _mm_storeu_ps(x1 + i, _mm_add_ps(cx, _mm_mul_ps(inner, c)));
+        _mm_storeu_ps(y1 + i, _mm_add_ps(cy, _mm_mul_ps(inner, s)));
+        _mm_storeu_ps(x2 + i, _mm_add_ps(cx, _mm_mul_ps(outer, c)));
+        _mm_storeu_ps(y2 + i, _mm_add_ps(cy, _mm_mul_ps(outer, s)));
+    }
+#endif
+    for (; i < count; i++) {
+        x1[i] = centerX + innerRadius * cosines[i];
+        y1[i] = centerY + innerRadius * sines[i];
+        x2[i] = centerX + outerRadius * cosines[i];
+        y2[i] = centerY + outerRadius * sines[i];
+    }
+}
@@ -0,0 +1,38 @@
+/*
+ * gipGaugeTickKernel.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef SRC_GIPGAUGETICKKERNEL_H_
+#define SRC_GIPGAUGETICKKERNEL_H_
+
+#include "gipGaugeAllocator.h"
+
+// Radial tick segments as flat arrays, one entry per tick, from the inner
+// endpoint (x1, y1) to the outer endpoint (x2, y2)
+struct gipGaugeTickArrays {
+    gipGaugeVector<float> x1, y1, x2, y2;
+
+    void clear();
+    int size() const;
+};
+
+// Tick geometry without a cos/sin call per tick. Evenly spaced ticks form an
+// arithmetic progression of angles, so each unit vector is the previous one
+// rotated by a fixed step. Four consecutive ticks are rotated per SIMD step,
+// and the recurrence restarts from an exact cos/sin every RESEED_INTERVAL
+// ticks so rounding cannot build up on fine dials.
+class gipGaugeTickKernel {
+public:
+    static const int RESEED_INTERVAL = 64;
+
+    // Unit vectors of count angles startAngle + i * stepAngle, in degrees
+    static void directions(double startAngle, double stepAngle, int count, float* cosines, float* sines);
+    // Appends one segment per unit vector, from innerRadius to outerRadius
+    // around the center
+    static void endpoints(const float* cosines, const float* sines, int count,
+                          float centerX, float centerY, float innerRadius, float outerRadius, gipGaugeTickArrays& out);
+};
+
+#endif /* SRC_GIPGAUGETICKKERNEL_H_ */
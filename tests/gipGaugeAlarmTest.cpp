@@ -0,0 +1,160 @@
+/*
+ * gipGaugeAlarmTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTest.h"
+#include "gipGauge.h"
+#include "gipGaugeScheduler.h"
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static void setupGauge(gipGauge& gauge, float dwell) {
+    gauge.setAnimationEnabled(false);
+    gauge.setDangerZone(80.0f, 100.0f);
+    gauge.setZoneAlarm(gipGauge::ZONE_DANGER, true, 0.0f, dwell);
+}
+
+GIPGAUGE_TEST(blockSpikeRaisesAlarm) {
+    gipGauge gauge;
+    setupGauge(gauge, 0.0f);
+    gauge.setReductionPolicy(gipGauge::REDUCE_MEAN);
+
+    // One spike in a quiet block, the mean stays far below the zone
+    std::vector<float> samples(100, 10.0f);
+    samples[40] = 95.0f;
+    gauge.setValues(samples.data(), samples.size());
+    gauge.update();
+    GIPGAUGE_CHECK_NEAR(gauge.getValue(), 10.85f, 1e-4f);
+
+    std::vector<gipGaugeZoneEvent> events;
+    gauge.pollZoneEvents(events);
+    GIPGAUGE_CHECK(events.size() == 2);
+    if (events.size() == 2) {
+        GIPGAUGE_CHECK(events[0].zone == gipGauge::ZONE_DANGER && events[0].entered);
+        GIPGAUGE_CHECK(events[0].value == 95.0f);
+        GIPGAUGE_CHECK(!events[1].entered);
+    }
+    GIPGAUGE_CHECK(!gauge.isInZone(gipGauge::ZONE_DANGER));
+}
+
+GIPGAUGE_TEST(blockSpikeShorterThanDwellIsIgnored) {
+    gipGauge gauge;
+    setupGauge(gauge, 10.0f);
+    gauge.setReductionPolicy(gipGauge::REDUCE_MEAN);
+    std::vector<float> samples(100, 10.0f);
+    samples[40] = 95.0f;
+    gauge.setValues(samples.data(), samples.size());
+    gauge.update();
+
+    std::vector<gipGaugeZoneEvent> events;
+    gauge.pollZoneEvents(events);
+    GIPGAUGE_CHECK(events.empty());
+}
+
+GIPGAUGE_TEST(enablingChecksTheCurrentValue) {
+    gipGauge gauge;
+    gauge.setAnimationEnabled(false);
+    gauge.setDangerZone(80.0f, 100.0f);
+    gauge.setValue(90.0f);
+    gauge.update();
+
+    // No new sample arrives, the value already in the zone is still raised
+    gauge.setZoneAlarm(gipGauge::ZONE_DANGER, true);
+    gauge.update();
+    std::vector<gipGaugeZoneEvent> events;
+    gauge.pollZoneEvents(events);
+    GIPGAUGE_CHECK(events.size() == 1 && events[0].entered);
+    GIPGAUGE_CHECK(gauge.isInZone(gipGauge::ZONE_DANGER));
+}
+
+GIPGAUGE_TEST(enablingWakesTheScheduler) {
+    gipGaugeScheduler scheduler;
+    gipGauge gauge;
+    gauge.setAnimationEnabled(false);
+    gauge.setDangerZone(80.0f, 100.0f);
+    gauge.setScheduler(&scheduler);
+    gauge.setValue(90.0f);
+    for (int i = 0; i < 3; i++) scheduler.update(1.0f / 60.0f);
+    GIPGAUGE_CHECK(scheduler.getActiveNum() == 0);
+
+    gauge.setZoneAlarm(gipGauge::ZONE_DANGER, true);
+    GIPGAUGE_CHECK(scheduler.getActiveNum() == 1);
+    scheduler.update(1.0f / 60.0f);
+    std::vector<gipGaugeZoneEvent> events;
+    gauge.pollZoneEvents(events);
+    GIPGAUGE_CHECK(events.size() == 1 && events[0].entered);
+    scheduler.update(1.0f / 60.0f);
+    GIPGAUGE_CHECK(scheduler.getActiveNum() == 0);
+    gauge.setScheduler(nullptr);
+}
+
+GIPGAUGE_TEST(spikeBetweenFramesRaisesAlarm) {
+    gipGauge gauge;
+    setupGauge(gauge, 0.0f);
+    gauge.setValue(10.0f);
+    gauge.update();
+
+    // Into the zone and out again before the next frame, from another thread
+    std::thread producer([&gauge]() {
+        gauge.setValue(90.0f);
+        gauge.setValue(10.0f);
+    });
+    producer.join();
+    gauge.update();
+    GIPGAUGE_CHECK(gauge.getValue() == 10.0f);
+
+    std::vector<gipGaugeZoneEvent> events;
+    gauge.pollZoneEvents(events);
+    GIPGAUGE_CHECK(events.size() == 2);
+    if (events.size() == 2) {
+        GIPGAUGE_CHECK(events[0].entered && events[0].value == 90.0f);
+        GIPGAUGE_CHECK(!events[1].entered && events[1].value == 10.0f);
+        GIPGAUGE_CHECK(events[0].time <= events[1].time);
+    }
+}
+
+GIPGAUGE_TEST(dwellIsMeasuredInIngestionTime) {
+    gipGauge gauge;
+    setupGauge(gauge, 0.02f);
+
+    // Held longer than the dwell between two calls of one frame
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    gauge.setValue(90.0f);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    gauge.setValue(10.0f);
+    gauge.update();
+    std::vector<gipGaugeZoneEvent> events;
+    gauge.pollZoneEvents(events);
+    GIPGAUGE_CHECK(events.size() == 1 && events[0].entered);
+    if (!events.empty()) {
+        float completed = std::chrono::duration<float>(events[0].time - start).count();
+        GIPGAUGE_CHECK(completed >= 0.02f && completed < 0.05f);
+    }
+    // Leaving waits out the dwell too
+    GIPGAUGE_CHECK(gauge.isInZone(gipGauge::ZONE_DANGER));
+}
+
+GIPGAUGE_TEST(removingZoneKeepsAlarmIds) {
+    gipGauge gauge;
+    gauge.setAnimationEnabled(false);
+    gauge.addZone(0.0f, 10.0f, gColor());
+    gauge.addZone(20.0f, 30.0f, gColor());
+    int high = gauge.addZone(40.0f, 50.0f, gColor());
+    gauge.setZoneAlarm(high, true);
+    gauge.removeZone(0);
+
+    GIPGAUGE_CHECK(gauge.findZoneIndex(high) == 1);
+    GIPGAUGE_CHECK(gauge.findZoneIndex(0) == -1);
+    GIPGAUGE_CHECK(gauge.isZoneAlarmEnabled(1) && !gauge.isZoneAlarmEnabled(0));
+    gauge.setValue(45.0f);
+    gauge.update();
+    std::vector<gipGaugeZoneEvent> events;
+    gauge.pollZoneEvents(events);
+    GIPGAUGE_CHECK(events.size() == 1 && events[0].zone == high && events[0].entered);
+    GIPGAUGE_CHECK(gauge.isInZone(1));
+}
+
+GIPGAUGE_TEST_MAIN()
@@ -0,0 +1,95 @@
+/*
+ * gipGaugeAnimatorTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTest.h"
+#include "gipGaugeAnimator.h"
+#include "gipGauge.h"
+#include <cmath>
+
+// Advances slots from 0 towards 100 for one second at the given frame rate.
+// Five slots cover the vectorized lanes and the scalar tail.
+static float animateOneSecond(int framesPerSecond, int slot) {
+    gipGaugeAnimator animator;
+    for (int i = 0; i < 5; i++) {
+        animator.addSlot(nullptr, 0.0f);
+        animator.setTarget(i, 100.0f);
+        animator.setSpeed(i, 2.0f);
+    }
+    for (int frame = 0; frame < framesPerSecond; frame++) animator.update(1.0f / framesPerSecond);
+    return animator.getCurrent(slot);
+}
+
+GIPGAUGE_TEST(settlingDoesNotDependOnFrameRate) {
+    // Exponential decay at speed 2 covers 1 - e^-2 of the distance per second
+    float expected = 100.0f * (1.0f - std::exp(-2.0f));
+    for (int slot : {0, 4}) {
+        GIPGAUGE_CHECK_NEAR(animateOneSecond(30, slot), expected, 0.01);
+        GIPGAUGE_CHECK_NEAR(animateOneSecond(60, slot), expected, 0.01);
+        GIPGAUGE_CHECK_NEAR(animateOneSecond(240, slot), expected, 0.01);
+    }
+}
+
+GIPGAUGE_TEST(longFramesDoNotOvershoot) {
+    gipGaugeAnimator animator;
+    animator.addSlot(nullptr, 0.0f);
+    animator.setTarget(0, 100.0f);
+    animator.setSpeed(0, 50.0f);
+    animator.update(0.25f);
+    GIPGAUGE_CHECK(animator.getCurrent(0) <= 100.0f);
+    GIPGAUGE_CHECK_NEAR(animator.getCurrent(0), 100.0f, 0.001);
+}
+
+GIPGAUGE_TEST(slotsKeepTheirOwnSpeed) {
+    // Shared and distinct speeds across the vectorized lanes, with freed
+    // slots reused at a different speed
+    gipGaugeAnimator animator;
+    for (int i = 0; i < 9; i++) {
+        animator.addSlot(nullptr, 0.0f);
+        animator.setSpeed(i, 1.0f + i % 3);
+    }
+    animator.removeSlot(2);
+    animator.removeSlot(7);
+    GIPGAUGE_CHECK(animator.addSlot(nullptr, 0.0f) == 7);
+    GIPGAUGE_CHECK(animator.addSlot(nullptr, 0.0f) == 2);
+    animator.setSpeed(7, 4.0f);
+    animator.setSpeed(2, 1.0f);
+    for (int i = 0; i < 9; i++) animator.setTarget(i, 100.0f);
+    for (int frame = 0; frame < 60; frame++) animator.update(1.0f / 60.0f);
+
+    const float speeds[9] = {1.0f, 2.0f, 1.0f, 1.0f, 2.0f, 3.0f, 1.0f, 4.0f, 3.0f};
+    for (int i = 0; i < 9; i++) {
+        GIPGAUGE_CHECK_NEAR(animator.getCurrent(i), 100.0f * (1.0f - std::exp(-speeds[i])), 0.01);
+    }
+}
+
+GIPGAUGE_TEST(gaugeFeedsTargetAndSpeedChanges) {
+    gipGaugeAnimator animator;
+    gipGauge gauge;
+    gauge.setAnimationSpeed(2.0f);
+    gauge.setAnimator(&animator);
+    gauge.setValue(100.0f);
+    for (int frame = 0; frame < 60; frame++) {
+        gauge.update();
+        animator.update(1.0f / 60.0f);
+    }
+    gauge.update();
+    GIPGAUGE_CHECK_NEAR(gauge.getValue(), 100.0f * (1.0f - std::exp(-2.0f)), 0.01);
+
+    // A new speed and target reach the slot, disabling animation snaps
+    gauge.setAnimationSpeed(50.0f);
+    gauge.setValue(20.0f);
+    gauge.update();
+    animator.update(0.25f);
+    gauge.update();
+    GIPGAUGE_CHECK_NEAR(gauge.getValue(), 20.0f, 0.001);
+    gauge.setAnimationEnabled(false);
+    gauge.setValue(70.0f);
+    gauge.update();
+    GIPGAUGE_CHECK(gauge.getValue() == 70.0f);
+    gauge.setAnimator(nullptr);
+}
+
+GIPGAUGE_TEST_MAIN()
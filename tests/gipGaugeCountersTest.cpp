@@ -0,0 +1,121 @@
+/*
+ * gipGaugeCountersTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTest.h"
+#include "gipGauge.h"
+#include "gipGaugeBatch.h"
+#include "gipGaugeDrawList.h"
+#include <cstdlib>
+#include <new>
+
+// Every heap allocation of the test, to catch those the counters cannot see
+static uint64_t heapallocations = 0;
+
+void* operator new(size_t size) {
+    heapallocations++;
+    void* memory = std::malloc(size ? size : 1);
+    if (memory == nullptr) throw std::bad_alloc();
+    return memory;
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    std::free(memory);
+}
+
+// Accepts everything and keeps nothing
+class gipGaugeNullBackend : public gipGaugeBackend {
+public:
+    void setColor(const gColor&) {}
+    void drawLine(float, float, float, float) {}
+    void drawArc(float, float, float, float, float, bool, int) {}
+    void drawCircle(float, float, float, bool, int) {}
+    void drawRectangle(float, float, float, float, bool) {}
+    void drawText(const std::string&, float, float, int) {}
+};
+
+static void setupGauge(gipGauge& gauge, gipGaugeDrawList& list) {
+    gauge.setAnimationEnabled(false);
+    gauge.setBackend(&list);
+    gauge.setValue(42.0f);
+}
+
+GIPGAUGE_TEST(frameCountersFollowTheFlag) {
+    gipGauge gauge;
+    gipGaugeDrawList list;
+    setupGauge(gauge, list);
+    gauge.draw(0, 0, 200, 200);
+    const gipGaugeCounters& frame = gauge.getFrameCounters();
+    if (gipGaugeCounters::isEnabled()) {
+        GIPGAUGE_CHECK(frame.frames == 1);
+        GIPGAUGE_CHECK(frame.primitives == static_cast<uint64_t>(list.getPrimitiveNum()));
+        GIPGAUGE_CHECK(frame.stagecalls[gipGaugeCounters::STAGE_NEEDLE] == 1);
+        GIPGAUGE_CHECK(gauge.getCounters().frames == 1);
+    } else {
+        GIPGAUGE_CHECK(frame.frames == 0 && frame.primitives == 0);
+        GIPGAUGE_CHECK(&frame == &gipGaugeCounters::getEmpty());
+    }
+    gauge.resetCounters();
+    GIPGAUGE_CHECK(gauge.getCounters().frames == 0);
+}
+
+GIPGAUGE_TEST(allocationsCountFrameBuffers) {
+    gipGauge gauge;
+    gipGaugeDrawList list;
+    setupGauge(gauge, list);
+
+    // The first frame sizes the tick and draw list buffers, later frames reuse them
+    uint64_t start = gipGaugeCounters::getBufferAllocationNum();
+    gauge.draw(0, 0, 200, 200);
+    uint64_t first = gipGaugeCounters::getBufferAllocationNum() - start;
+    list.clear();
+    gauge.draw(0, 0, 200, 200);
+    if (gipGaugeCounters::isEnabled()) {
+        GIPGAUGE_CHECK(first > 0);
+        GIPGAUGE_CHECK(gauge.getFrameCounters().bufferallocations == 0);
+    } else {
+        GIPGAUGE_CHECK(first == 0);
+    }
+}
+
+GIPGAUGE_TEST(overlayOnlyWithTheFlag) {
+    gipGauge gauge;
+    gipGaugeDrawList plain, overlaid;
+    setupGauge(gauge, plain);
+    gauge.draw(0, 0, 200, 200);
+    gauge.setShowCountersOverlay(true);
+    gauge.setBackend(&overlaid);
+    gauge.draw(0, 0, 200, 200);
+    GIPGAUGE_CHECK(gauge.getShowCountersOverlay() == gipGaugeCounters::isEnabled());
+    if (gipGaugeCounters::isEnabled()) GIPGAUGE_CHECK(overlaid.getPrimitiveNum() > plain.getPrimitiveNum());
+    else GIPGAUGE_CHECK(overlaid.getPrimitiveNum() == plain.getPrimitiveNum());
+}
+
+GIPGAUGE_TEST(steadyBatchFrameDoesNotAllocate) {
+    gipGaugeNullBackend backend;
+    gipGauge gauges[3];
+    gipGaugeBatch batch;
+    batch.setBackend(&backend);
+    for (int i = 0; i < 3; i++) {
+        gauges[i].setAnimationEnabled(false);
+        gauges[i].setTitle("a title longer than the small string buffer");
+        gauges[i].setValue(20.0f * i);
+        batch.addGauge(&gauges[i], i * 200, 0, 200, 200);
+    }
+    batch.draw();
+    batch.draw();
+
+    // Neither the text storage nor the sort allocates once warmed up
+    uint64_t start = heapallocations;
+    batch.draw();
+    GIPGAUGE_CHECK(heapallocations == start);
+    GIPGAUGE_CHECK(batch.getFrameCounters().bufferallocations == 0);
+}
+
+GIPGAUGE_TEST_MAIN()
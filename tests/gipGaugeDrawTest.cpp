@@ -0,0 +1,95 @@
+/*
+ * gipGaugeDrawTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTest.h"
+#include "gipGauge.h"
+#include "gipGaugeBatch.h"
+#include "gipGaugeDrawList.h"
+#include <memory>
+#include <vector>
+
+// Measures text far wider than the default estimate, as a real font might
+class gipGaugeWideTextList : public gipGaugeDrawList {
+public:
+    void measureText(const std::string& text, int fontSize, float& width, float& height) {
+        gipGaugeDrawList::measureText(text, fontSize, width, height);
+        width *= 4.0f;
+    }
+};
+
+static int countTickLabels(bool retained) {
+    gipGauge gauge;
+    gauge.setGaugeType(gipGauge::GAUGE_SEMICIRCLE);
+    gauge.setValueRange(0.0f, 10000.0f);
+    gauge.setMajorTickCount(20);
+    gauge.setShowValue(false);
+    gauge.setShowTitle(false);
+    gauge.setLodEnabled(true);
+    gauge.setRetainedMode(retained);
+
+    gipGaugeWideTextList list;
+    gauge.setBackend(&list);
+    gauge.draw(0, 0, 400, 400);
+    return list.getCommandNum(gipGaugeDrawList::COMMAND_TEXT);
+}
+
+GIPGAUGE_TEST(retainedModeCullsLabelsLikeImmediateMode) {
+    int immediate = countTickLabels(false);
+    int retained = countTickLabels(true);
+    GIPGAUGE_CHECK(immediate > 0);
+    GIPGAUGE_CHECK(immediate < 21);
+    GIPGAUGE_CHECK(retained == immediate);
+}
+
+GIPGAUGE_TEST(batchCullsByViewportAndOccluders) {
+    // Titles name the case each gauge covers
+    const char* titles[] = {"outside", "inside", "partial", "occluded", "between"};
+    const int rects[][4] = {
+        {900, 100, 100, 100},   // Right of the viewport
+        {100, 100, 100, 100},
+        {750, 300, 100, 100},   // Straddles the right edge
+        {300, 300, 100, 100},   // Inside the first occluder
+        {500, 100, 100, 100}    // Half under each of the other two occluders
+    };
+    std::vector<std::unique_ptr<gipGauge>> gauges;
+    gipGaugeDrawList list;
+    gipGaugeBatch batch;
+    batch.setBackend(&list);
+    batch.setCullMargin(0);
+    for (int i = 0; i < 5; i++) {
+        gauges.emplace_back(new gipGauge());
+        gauges[i]->setTitle(titles[i]);
+        batch.addGauge(gauges[i].get(), rects[i][0], rects[i][1], rects[i][2], rects[i][3]);
+    }
+    batch.setViewport(0, 0, 800, 600);
+    batch.addOccluder(280, 280, 140, 140);
+    batch.addOccluder(480, 80, 70, 140);
+    batch.addOccluder(550, 80, 70, 140);
+
+    batch.draw();
+    std::string output = list.toString();
+    GIPGAUGE_CHECK(batch.getVisibleGaugeNum() == 3);
+    GIPGAUGE_CHECK(output.find("outside") == std::string::npos);
+    GIPGAUGE_CHECK(output.find("inside") != std::string::npos);
+    GIPGAUGE_CHECK(output.find("partial") != std::string::npos);
+    GIPGAUGE_CHECK(output.find("occluded") == std::string::npos);
+    GIPGAUGE_CHECK(output.find("between") != std::string::npos);
+
+    // Clearing the gauges keeps the culling setup for the next ones
+    batch.clear();
+    for (int i = 0; i < 5; i++) batch.addGauge(gauges[i].get(), rects[i][0], rects[i][1], rects[i][2], rects[i][3]);
+    list.clear();
+    batch.draw();
+    GIPGAUGE_CHECK(batch.getVisibleGaugeNum() == 3);
+
+    batch.clearViewport();
+    batch.clearOccluders();
+    list.clear();
+    batch.draw();
+    GIPGAUGE_CHECK(batch.getVisibleGaugeNum() == 5);
+}
+
+GIPGAUGE_TEST_MAIN()
@@ -0,0 +1,198 @@
+/*
+ * gipGaugeMeshBuilderTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTest.h"
+#include "gipGauge.h"
+#include "gipGaugeDrawList.h"
+#include "gipGaugeMeshBuilder.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// A small dashboard covering every gauge type, a retained static layer and
+// the overlays of the dynamic region
+struct gipGaugeMeshDashboard {
+    std::vector<std::unique_ptr<gipGauge>> gauges;
+    std::vector<int> rects;
+
+    gipGaugeMeshDashboard() {
+        const gipGauge::GaugeType types[4] = {
+            gipGauge::GAUGE_CIRCULAR, gipGauge::GAUGE_SEMICIRCLE,
+            gipGauge::GAUGE_LINEAR_HORIZONTAL, gipGauge::GAUGE_LINEAR_VERTICAL
+        };
+        for (int i = 0; i < 4; i++) {
+            gauges.emplace_back(new gipGauge());
+            gipGauge& gauge = *gauges.back();
+            gauge.setGaugeType(types[i]);
+            gauge.setAnimationEnabled(false);
+            gauge.setRetainedMode(i == 0);
+            gauge.setDangerZone(80.0f, 100.0f);
+            gauge.setWarningZone(60.0f, 80.0f);
+            gauge.setHistorySize(64, 1);
+            gauge.setShowSparkline(i >= 2);
+            gauge.setShowPeakMarkers(true);
+            gauge.setTitle("Gauge");
+            for (int v = 0; v < 20; v++) {
+                gauge.setValue(30.0f + v * (i + 1));
+                gauge.update();
+            }
+            int rect[4] = {i * 220, 0, 200, i >= 2 ? 60 : 200};
+            rects.insert(rects.end(), rect, rect + 4);
+        }
+    }
+
+    void draw(gipGaugeBackend& backend) {
+        for (size_t i = 0; i < gauges.size(); i++) {
+            gauges[i]->setBackend(&backend);
+            gauges[i]->draw(rects[i * 4], rects[i * 4 + 1], rects[i * 4 + 2], rects[i * 4 + 3]);
+        }
+    }
+
+    void setValue(float value) {
+        for (std::unique_ptr<gipGauge>& gauge : gauges) {
+            gauge->setValue(value);
+            gauge->update();
+        }
+    }
+};
+
+struct gipGaugeMeshBuffers {
+    std::vector<gipGaugeMeshBuilder::Vertex> vertices;
+    std::vector<uint32_t> indices;
+    gipGaugeMeshBuilder mesh;
+
+    gipGaugeMeshBuffers() : vertices(1 << 16), indices(1 << 18) {
+        mesh.setBuffers(vertices.data(), vertices.size(), indices.data(), indices.size());
+    }
+};
+
+// Vertices and indices a primitive tessellates to, derived independently
+static void countPrimitive(const gipGaugeDrawList::Command& command, int& vertexNum, int& indexNum) {
+    switch (command.type) {
+        case gipGaugeDrawList::COMMAND_LINE:
+            // Zero-length lines have no direction to widen along
+            if (command.p[0] == command.p[2] && command.p[1] == command.p[3]) break;
+            vertexNum += 4;
+            indexNum += 6;
+            break;
+        case gipGaugeDrawList::COMMAND_ARC:
+        case gipGaugeDrawList::COMMAND_CIRCLE: {
+            int segments = std::max(1, static_cast<int>(command.arg0));
+            vertexNum += command.filled ? segments + 2 : (segments + 1) * 2;
+            indexNum += command.filled ? segments * 3 : segments * 6;
+            break;
+        }
+        case gipGaugeDrawList::COMMAND_RECTANGLE:
+            vertexNum += command.filled ? 4 : 16;
+            indexNum += command.filled ? 6 : 24;
+            break;
+    }
+}
+
+static bool isVertexEqual(const gipGaugeMeshBuilder::Vertex& a, const gipGaugeMeshBuilder::Vertex& b) {
+    return a.x == b.x && a.y == b.y && a.color == b.color;
+}
+
+GIPGAUGE_TEST(regionsMatchDirectDraw) {
+    gipGaugeMeshDashboard dashboard;
+    gipGaugeDrawList direct, text;
+    dashboard.draw(direct);
+
+    gipGaugeMeshBuffers built;
+    built.mesh.setTextBackend(&text);
+    built.mesh.begin(true);
+    dashboard.draw(built.mesh);
+    built.mesh.end();
+    GIPGAUGE_CHECK(!built.mesh.hasOverflowed());
+
+    // Region sizes follow from the directly drawn primitives and their layers
+    int staticvertices = 0, staticindices = 0, dynamicvertices = 0, dynamicindices = 0, texts = 0;
+    for (const gipGaugeDrawList::Command& command : direct.getCommands()) {
+        if (command.type == gipGaugeDrawList::COMMAND_TEXT) texts++;
+        if (command.layer < gipGaugeBackend::LAYER_NEEDLE) countPrimitive(command, staticvertices, staticindices);
+        else countPrimitive(command, dynamicvertices, dynamicindices);
+    }
+    GIPGAUGE_CHECK(staticvertices > 0 && dynamicvertices > 0);
+    GIPGAUGE_CHECK(built.mesh.getStaticVertexNum() == staticvertices);
+    GIPGAUGE_CHECK(built.mesh.getStaticIndexNum() == staticindices);
+    GIPGAUGE_CHECK(built.mesh.getVertexNum() == staticvertices + dynamicvertices);
+    GIPGAUGE_CHECK(built.mesh.getIndexNum() == staticindices + dynamicindices);
+    GIPGAUGE_CHECK(text.getCommandNum(gipGaugeDrawList::COMMAND_TEXT) == texts);
+
+    // Tessellating the direct recording gives the same buffers
+    gipGaugeMeshBuffers replayed;
+    replayed.mesh.begin(true);
+    direct.replay(replayed.mesh);
+    replayed.mesh.end();
+    GIPGAUGE_CHECK(replayed.mesh.getVertexNum() == built.mesh.getVertexNum());
+    GIPGAUGE_CHECK(replayed.mesh.getIndexNum() == built.mesh.getIndexNum());
+    int mismatches = 0;
+    for (int i = 0; i < std::min(built.mesh.getVertexNum(), replayed.mesh.getVertexNum()); i++) {
+        if (!isVertexEqual(built.vertices[i], replayed.vertices[i])) mismatches++;
+    }
+    for (int i = 0; i < std::min(built.mesh.getIndexNum(), replayed.mesh.getIndexNum()); i++) {
+        if (built.indices[i] != replayed.indices[i]) mismatches++;
+        if (built.indices[i] >= static_cast<uint32_t>(built.mesh.getVertexNum())) mismatches++;
+    }
+    GIPGAUGE_CHECK(mismatches == 0);
+}
+
+GIPGAUGE_TEST(dynamicFrameKeepsStaticRegion) {
+    gipGaugeMeshDashboard dashboard;
+    gipGaugeMeshBuffers built;
+    built.mesh.begin(true);
+    dashboard.draw(built.mesh);
+    built.mesh.end();
+    int staticvertices = built.mesh.getStaticVertexNum();
+    int staticindices = built.mesh.getStaticIndexNum();
+    std::vector<gipGaugeMeshBuilder::Vertex> staticcopy(built.vertices.begin(), built.vertices.begin() + staticvertices);
+    std::vector<uint32_t> staticindexcopy(built.indices.begin(), built.indices.begin() + staticindices);
+
+    // New values only touch the dynamic region
+    dashboard.setValue(95.0f);
+    gipGaugeDrawList direct;
+    dashboard.draw(direct);
+    built.mesh.begin(false);
+    dashboard.draw(built.mesh);
+    built.mesh.end();
+    GIPGAUGE_CHECK(built.mesh.getStaticVertexNum() == staticvertices);
+    GIPGAUGE_CHECK(std::memcmp(built.vertices.data(), staticcopy.data(), staticvertices * sizeof(gipGaugeMeshBuilder::Vertex)) == 0);
+    GIPGAUGE_CHECK(std::equal(staticindexcopy.begin(), staticindexcopy.end(), built.indices.begin()));
+
+    // and match a full rebuild from the direct recording of the new frame
+    gipGaugeMeshBuffers replayed;
+    replayed.mesh.begin(true);
+    direct.replay(replayed.mesh);
+    replayed.mesh.end();
+    GIPGAUGE_CHECK(replayed.mesh.getStaticVertexNum() == staticvertices);
+    GIPGAUGE_CHECK(replayed.mesh.getVertexNum() == built.mesh.getVertexNum());
+    GIPGAUGE_CHECK(replayed.mesh.getIndexNum() == built.mesh.getIndexNum());
+    int mismatches = 0;
+    for (int i = staticvertices; i < std::min(built.mesh.getVertexNum(), replayed.mesh.getVertexNum()); i++) {
+        if (!isVertexEqual(built.vertices[i], replayed.vertices[i])) mismatches++;
+    }
+    for (int i = staticindices; i < std::min(built.mesh.getIndexNum(), replayed.mesh.getIndexNum()); i++) {
+        if (built.indices[i] != replayed.indices[i]) mismatches++;
+    }
+    GIPGAUGE_CHECK(mismatches == 0);
+}
+
+GIPGAUGE_TEST(overflowDropsPrimitivesInsideCapacity) {
+    gipGaugeMeshDashboard dashboard;
+    std::vector<gipGaugeMeshBuilder::Vertex> vertices(64);
+    std::vector<uint32_t> indices(96);
+    gipGaugeMeshBuilder mesh;
+    mesh.setBuffers(vertices.data(), vertices.size(), indices.data(), indices.size());
+    mesh.begin(true);
+    dashboard.draw(mesh);
+    mesh.end();
+    GIPGAUGE_CHECK(mesh.hasOverflowed());
+    GIPGAUGE_CHECK(mesh.getVertexNum() <= 64);
+    GIPGAUGE_CHECK(mesh.getIndexNum() <= 96);
+}
+
+GIPGAUGE_TEST_MAIN()
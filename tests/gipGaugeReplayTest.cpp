@@ -0,0 +1,130 @@
+/*
+ * gipGaugeReplayTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTest.h"
+#include "gipGauge.h"
+#include "gipGaugeReplay.h"
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+// Gauge 0 changes twice early on, gauge 1 on every other record, so most
+// seek targets are thousands of records past gauge 0's last change
+static const int RECORD_NUM = 20000;
+
+static std::string writeLog(const char* name, bool closed, int keyframeInterval = 64) {
+    std::string path = std::string("/tmp/gipGaugeReplayTest.") + name + ".gipr";
+    gipGaugeReplayWriter writer;
+    writer.open(path);
+    writer.setIndexInterval(1000);
+    writer.setKeyframeInterval(keyframeInterval);
+    for (int i = 0; i < RECORD_NUM; i++) {
+        uint64_t timestamp = 1000ULL * i;
+        if (i == 10) writer.write(timestamp, 0, 42.0f);
+        else if (i == 1500) writer.write(timestamp, 0, 17.0f);
+        else if (i % 2 == 0) writer.write(timestamp, 1, static_cast<float>(i));
+        else writer.write(timestamp, 2, static_cast<float>(-i));
+    }
+    writer.close();
+    // Cut the footer and half a record, as a crash would leave the log
+    if (!closed) std::filesystem::resize_file(path, 16 + 16 * RECORD_NUM - 8);
+    return path;
+}
+
+static void setupGauge(gipGauge& gauge) {
+    gauge.setValueRange(-1e6f, 1e6f);
+    gauge.setAnimationEnabled(false);
+}
+
+// Plays from the start up to the target and seeks there from the end, both
+// must leave every gauge at the same value. Targets lie past the first
+// value of every gauge, seeking does not reset gauges without one.
+static void checkSeek(const std::string& path, uint64_t target) {
+    gipGauge played[3], sought[3];
+    gipGaugeReplay playback, seeker;
+    GIPGAUGE_CHECK(playback.open(path));
+    GIPGAUGE_CHECK(seeker.open(path));
+    for (int i = 0; i < 3; i++) {
+        setupGauge(played[i]);
+        setupGauge(sought[i]);
+        playback.setGauge(i, &played[i]);
+        seeker.setGauge(i, &sought[i]);
+    }
+
+    playback.advance((target - playback.getStartTime()) * 1e-6 - 1e-9);
+    seeker.seek(seeker.getEndTime());
+    seeker.seek(target);
+    GIPGAUGE_CHECK(seeker.getRecordIndex() == playback.getRecordIndex());
+    for (int i = 0; i < 3; i++) {
+        played[i].update();
+        sought[i].update();
+        GIPGAUGE_CHECK(sought[i].getValue() == played[i].getValue());
+    }
+}
+
+GIPGAUGE_TEST(seekRestoresGaugesThatChangedLongAgo) {
+    std::string path = writeLog("indexed", true);
+    gipGauge gauge;
+    setupGauge(gauge);
+    gipGaugeReplay replay;
+    GIPGAUGE_CHECK(replay.open(path));
+    GIPGAUGE_CHECK(replay.getRecordNum() == RECORD_NUM);
+    replay.setGauge(0, &gauge);
+    replay.seek(1000ULL * 19000);
+    gauge.update();
+    GIPGAUGE_CHECK(gauge.getValue() == 17.0f);
+    std::remove(path.c_str());
+}
+
+GIPGAUGE_TEST(seekMatchesPlaybackWithIndex) {
+    std::string path = writeLog("playback", true);
+    for (uint64_t record : {11, 999, 1000, 1001, 1500, 1501, 7000, 15999, 19999}) {
+        checkSeek(path, 1000ULL * record);
+    }
+    std::remove(path.c_str());
+}
+
+GIPGAUGE_TEST(seekMatchesPlaybackWithKeyframes) {
+    // Entries 0, 3, 6... are full, the others fold changes onto them
+    std::string path = writeLog("keyframes", true, 3);
+    for (uint64_t record : {11, 1000, 1501, 2999, 3000, 4001, 7000, 15999, 19999}) {
+        checkSeek(path, 1000ULL * record);
+    }
+    std::remove(path.c_str());
+}
+
+GIPGAUGE_TEST(unorderedIndexIsIgnored) {
+    std::string path = writeLog("unordered", true);
+    // Point the third index entry back at record 0
+    FILE* file = std::fopen(path.c_str(), "r+b");
+    uint64_t zero = 0;
+    std::fseek(file, 16 + 16 * RECORD_NUM + 2 * 24 + 8, SEEK_SET);
+    std::fwrite(&zero, sizeof(zero), 1, file);
+    std::fclose(file);
+
+    // The index is dropped, seeking falls back to replaying from the start
+    gipGaugeReplay replay;
+    GIPGAUGE_CHECK(replay.open(path));
+    GIPGAUGE_CHECK(replay.getRecordNum() == RECORD_NUM);
+    for (uint64_t record : {11, 2500, 19999}) {
+        checkSeek(path, 1000ULL * record);
+    }
+    std::remove(path.c_str());
+}
+
+GIPGAUGE_TEST(seekMatchesPlaybackWithoutFooter) {
+    std::string path = writeLog("crashed", false);
+    gipGaugeReplay replay;
+    GIPGAUGE_CHECK(replay.open(path));
+    GIPGAUGE_CHECK(replay.getRecordNum() == RECORD_NUM - 1);
+    uint64_t last = replay.getRecordNum() - 1;
+    for (uint64_t record : {static_cast<uint64_t>(11), static_cast<uint64_t>(1600), last}) {
+        checkSeek(path, 1000ULL * record);
+    }
+    std::remove(path.c_str());
+}
+
+GIPGAUGE_TEST_MAIN()
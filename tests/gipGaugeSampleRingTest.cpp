@@ -0,0 +1,166 @@
+/*
+ * gipGaugeSampleRingTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTest.h"
+#include "gipGauge.h"
+#include "gipGaugeSampleRing.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Every producer publishes strictly increasing values from its own range, so
+// each published value is unique. A value consumed twice in a row is a
+// duplicated sample, and a value going backwards within a producer range is a
+// reordered one.
+static const int PRODUCER_NUM = 4;
+static const int PUBLISH_NUM = 200000;
+static const float PRODUCER_STRIDE = 1000000.0f;
+
+static float getPublishedValue(int producer, int i) {
+    return producer * PRODUCER_STRIDE + i;
+}
+
+static void checkConsumed(const std::vector<float>& consumed) {
+    std::vector<float> last(PRODUCER_NUM, -1.0f);
+    int duplicates = 0, reordered = 0;
+    for (size_t i = 0; i < consumed.size(); i++) {
+        if (i > 0 && consumed[i] == consumed[i - 1]) duplicates++;
+        int producer = static_cast<int>(consumed[i] / PRODUCER_STRIDE);
+        if (consumed[i] < last[producer]) reordered++;
+        last[producer] = consumed[i];
+    }
+    GIPGAUGE_CHECK(!consumed.empty());
+    GIPGAUGE_CHECK(consumed.size() <= static_cast<size_t>(PRODUCER_NUM * PUBLISH_NUM));
+    GIPGAUGE_CHECK(duplicates == 0);
+    GIPGAUGE_CHECK(reordered == 0);
+}
+
+GIPGAUGE_TEST(valueSlotConsumesEachPublishOnce) {
+    gipGaugeValueSlot slot;
+    float value;
+    GIPGAUGE_CHECK(!slot.consume(value));
+    slot.publish(1.5f);
+    GIPGAUGE_CHECK(slot.consume(value));
+    GIPGAUGE_CHECK(value == 1.5f);
+    GIPGAUGE_CHECK(!slot.consume(value));
+
+    // Republishing the same value is still a new sample
+    slot.publish(1.5f);
+    slot.publish(2.5f);
+    GIPGAUGE_CHECK(slot.consume(value));
+    GIPGAUGE_CHECK(value == 2.5f);
+    GIPGAUGE_CHECK(!slot.consume(value));
+}
+
+GIPGAUGE_TEST(valueSlotMultiProducerStress) {
+    gipGaugeValueSlot slot;
+    std::atomic<int> running(PRODUCER_NUM);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCER_NUM; p++) {
+        producers.emplace_back([&slot, &running, p]() {
+            for (int i = 0; i < PUBLISH_NUM; i++) slot.publish(getPublishedValue(p, i));
+            running.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    std::vector<float> consumed;
+    float value;
+    while (running.load(std::memory_order_acquire) > 0) {
+        if (slot.consume(value)) consumed.push_back(value);
+    }
+    if (slot.consume(value)) consumed.push_back(value);
+    for (std::thread& producer : producers) producer.join();
+
+    checkConsumed(consumed);
+    GIPGAUGE_CHECK(!slot.consume(value));
+}
+
+GIPGAUGE_TEST(sampleRingKeepsOrder) {
+    gipGaugeSampleRing<float> ring;
+    ring.allocate(100);
+    GIPGAUGE_CHECK(ring.getCapacity() == 128);
+
+    const int samplenum = 500000;
+    std::thread producer([&ring]() {
+        for (int i = 0; i < samplenum; i++) {
+            while (!ring.push(static_cast<float>(i))) std::this_thread::yield();
+        }
+    });
+    int expected = 0;
+    float value;
+    while (expected < samplenum) {
+        if (!ring.pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (value != expected) break;
+        expected++;
+    }
+    producer.join();
+    GIPGAUGE_CHECK(expected == samplenum);
+    GIPGAUGE_CHECK(!ring.pop(value));
+}
+
+GIPGAUGE_TEST(sharedRingTakesEveryPush) {
+    gipGaugeSharedRing<float> ring;
+    ring.allocate(100);
+    GIPGAUGE_CHECK(ring.getCapacity() == 128);
+
+    // Every pushed value arrives exactly once, in order per producer
+    const int pushnum = 50000;
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCER_NUM; p++) {
+        producers.emplace_back([&ring, p]() {
+            for (int i = 0; i < pushnum; i++) {
+                while (!ring.push(getPublishedValue(p, i))) std::this_thread::yield();
+            }
+        });
+    }
+    std::vector<float> consumed;
+    consumed.reserve(PRODUCER_NUM * pushnum);
+    float value;
+    while (consumed.size() < static_cast<size_t>(PRODUCER_NUM * pushnum)) {
+        if (ring.pop(value)) consumed.push_back(value);
+        else std::this_thread::yield();
+    }
+    for (std::thread& producer : producers) producer.join();
+    GIPGAUGE_CHECK(!ring.pop(value));
+    checkConsumed(consumed);
+    std::vector<int> counts(PRODUCER_NUM, 0);
+    for (float v : consumed) counts[static_cast<int>(v / PRODUCER_STRIDE)]++;
+    for (int count : counts) GIPGAUGE_CHECK(count == pushnum);
+}
+
+GIPGAUGE_TEST(setValueFromSeveralThreads) {
+    gipGauge gauge;
+    gauge.setValueRange(0.0f, PRODUCER_NUM * PRODUCER_STRIDE);
+    gauge.setAnimationEnabled(false);
+    gauge.setHistorySize(PRODUCER_NUM * PUBLISH_NUM, 1);
+
+    std::atomic<int> running(PRODUCER_NUM);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCER_NUM; p++) {
+        producers.emplace_back([&gauge, &running, p]() {
+            for (int i = 0; i < PUBLISH_NUM; i++) gauge.setValue(getPublishedValue(p, i));
+            running.fetch_sub(1, std::memory_order_release);
+        });
+    }
+    while (running.load(std::memory_order_acquire) > 0) gauge.update();
+    for (std::thread& producer : producers) producer.join();
+    gauge.update();
+
+    // Every update() recorded at most one sample, read back one per column
+    const gipGaugeHistory& history = gauge.getHistory();
+    int64_t samplenum = history.getSampleNum();
+    std::vector<float> minimum(samplenum), maximum(samplenum);
+    int columns = history.decimate(samplenum, samplenum, minimum.data(), maximum.data());
+    GIPGAUGE_CHECK(columns == samplenum);
+    minimum.resize(columns);
+    checkConsumed(minimum);
+    GIPGAUGE_CHECK(!minimum.empty() && gauge.getValue() == minimum.back());
+}
+
+GIPGAUGE_TEST_MAIN()
@@ -0,0 +1,122 @@
+/*
+ * gipGaugeSchedulerTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTest.h"
+#include "gipGauge.h"
+#include "gipGaugeScheduler.h"
+#include <atomic>
+#include <thread>
+
+// Steps the scheduler until nothing is active, returns the steps taken
+static int settle(gipGaugeScheduler& scheduler, int maxsteps = 10000) {
+    int steps = 0;
+    while (scheduler.getActiveNum() > 0 && steps < maxsteps) {
+        scheduler.update(1.0f / 60.0f);
+        steps++;
+    }
+    return steps;
+}
+
+GIPGAUGE_TEST(settledGaugeLeavesActive) {
+    gipGaugeScheduler scheduler;
+    gipGauge gauge;
+    gauge.setScheduler(&scheduler);
+    GIPGAUGE_CHECK(scheduler.getGaugeNum() == 1);
+
+    gauge.setValue(60.0f);
+    GIPGAUGE_CHECK(scheduler.getActiveNum() == 1);
+    scheduler.update(1.0f / 60.0f);
+    GIPGAUGE_CHECK(scheduler.getActiveNum() == 1);
+    GIPGAUGE_CHECK(settle(scheduler) < 10000);
+    GIPGAUGE_CHECK(scheduler.getActiveNum() == 0);
+    GIPGAUGE_CHECK(gauge.getValue() == 60.0f);
+
+    // A settled gauge stays asleep
+    scheduler.update(1.0f / 60.0f);
+    GIPGAUGE_CHECK(scheduler.getActiveNum() == 0);
+    gauge.setScheduler(nullptr);
+}
+
+GIPGAUGE_TEST(setValueFromAnotherThreadWakes) {
+    gipGaugeScheduler scheduler;
+    gipGauge gauge;
+    gauge.setScheduler(&scheduler);
+    settle(scheduler);
+    GIPGAUGE_CHECK(scheduler.getActiveNum() == 0);
+
+    // The producer writes while the render thread keeps stepping
+    std::atomic<bool> done(false);
+    std::thread producer([&] {
+        for (int i = 1; i <= 2000; i++) gauge.setValue(i % 100);
+        gauge.setValue(42.0f);
+        done = true;
+    });
+    while (!done) scheduler.update(1.0f / 60.0f);
+    producer.join();
+
+    GIPGAUGE_CHECK(settle(scheduler) < 10000);
+    GIPGAUGE_CHECK(gauge.getValue() == 42.0f);
+
+    // One late value after settling wakes it again
+    std::thread([&] { gauge.setValue(7.0f); }).join();
+    GIPGAUGE_CHECK(scheduler.getActiveNum() == 1);
+    settle(scheduler);
+    GIPGAUGE_CHECK(gauge.getValue() == 7.0f);
+    gauge.setScheduler(nullptr);
+}
+
+GIPGAUGE_TEST(detachDropsQueuedWake) {
+    gipGaugeScheduler scheduler;
+    gipGauge gauge, other;
+    gauge.setScheduler(&scheduler);
+    other.setScheduler(&scheduler);
+    settle(scheduler);
+
+    // The wake is still queued when the gauge leaves
+    gauge.setValue(30.0f);
+    gauge.setScheduler(nullptr);
+    GIPGAUGE_CHECK(scheduler.getGaugeNum() == 1);
+    GIPGAUGE_CHECK(scheduler.getActiveNum() == 0);
+    scheduler.update(1.0f / 60.0f);
+    GIPGAUGE_CHECK(scheduler.getActiveNum() == 0);
+
+    // The remaining gauge is unaffected, the detached one updates itself
+    other.setValue(10.0f);
+    GIPGAUGE_CHECK(scheduler.getActiveNum() == 1);
+    settle(scheduler);
+    GIPGAUGE_CHECK(other.getValue() == 10.0f);
+    gauge.setAnimationEnabled(false);
+    gauge.update();
+    GIPGAUGE_CHECK(gauge.getValue() == 30.0f);
+
+    // Reattaching steps it once, without a stale queue entry
+    gauge.setScheduler(&scheduler);
+    GIPGAUGE_CHECK(scheduler.getActiveNum() == 1);
+    settle(scheduler);
+    GIPGAUGE_CHECK(scheduler.getActiveNum() == 0);
+    gauge.setScheduler(nullptr);
+    other.setScheduler(nullptr);
+}
+
+GIPGAUGE_TEST(stepDoesNotDependOnFrameRate) {
+    // The same half second split into different step counts
+    const int stepcounts[] = {1, 3, 30, 144};
+    float reference = 0.0f;
+    for (int c = 0; c < 4; c++) {
+        gipGaugeScheduler scheduler;
+        gipGauge gauge;
+        gauge.setAnimationSpeed(4.0f);
+        gauge.setScheduler(&scheduler);
+        gauge.setValue(100.0f);
+        for (int i = 0; i < stepcounts[c]; i++) scheduler.update(0.5f / stepcounts[c]);
+        if (c == 0) reference = gauge.getValue();
+        GIPGAUGE_CHECK_NEAR(gauge.getValue(), reference, 0.01);
+        gauge.setScheduler(nullptr);
+    }
+    GIPGAUGE_CHECK_NEAR(reference, 100.0f * (1.0f - std::exp(-2.0f)), 0.01);
+}
+
+GIPGAUGE_TEST_MAIN()
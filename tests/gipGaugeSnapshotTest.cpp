@@ -0,0 +1,125 @@
+/*
+ * gipGaugeSnapshotTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTest.h"
+#include "gipGauge.h"
+#include "gipGaugeDashboard.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static void fillGauge(gipGauge& gauge, float scale) {
+    gauge.setValueRange(0.0f, 1000.0f * scale);
+    gauge.setTitle(scale > 1.0f ? "Pressure" : "Speed");
+    gauge.setAnimationEnabled(false);
+    gauge.setHistorySize(64, 3);
+    gauge.setStatsEnabled(true);
+    gauge.addZone(10.0f * scale, 20.0f * scale, gColor(0.1f, 0.2f, 0.3f, 1.0f));
+    for (int i = 0; i < 200; i++) {
+        gauge.setValue(i * scale);
+        gauge.update();
+    }
+}
+
+GIPGAUGE_TEST(snapshotRoundTrip) {
+    gipGauge source, copy;
+    fillGauge(source, 1.0f);
+    std::vector<uint8_t> data, restored;
+    source.snapshot(data);
+    GIPGAUGE_CHECK(copy.restore(data.data(), data.size()));
+    copy.snapshot(restored);
+    GIPGAUGE_CHECK(restored == data);
+}
+
+GIPGAUGE_TEST(truncatedSnapshotLeavesGaugeUntouched) {
+    gipGauge source, target;
+    fillGauge(source, 1.0f);
+    fillGauge(target, 3.0f);
+    std::vector<uint8_t> data, before, after;
+    source.snapshot(data);
+    target.snapshot(before);
+
+    // Every cut, including inside the history and statistics payloads
+    int accepted = 0;
+    for (size_t size = 0; size < data.size(); size++) {
+        if (target.restore(data.data(), size)) accepted++;
+    }
+    GIPGAUGE_CHECK(accepted == 0);
+    target.snapshot(after);
+    GIPGAUGE_CHECK(after == before);
+}
+
+GIPGAUGE_TEST(historyRejectsOversizedCapacity) {
+    gipGaugeHistory history;
+    history.allocate(16, 2);
+    history.push(5.0f);
+
+    // Claims a 2^30 sample ring backed by a few bytes
+    std::vector<uint8_t> data(64, 0);
+    int32_t capacity = 1 << 30, levels = 2;
+    std::memcpy(data.data(), &capacity, sizeof(capacity));
+    std::memcpy(data.data() + 4, &levels, sizeof(levels));
+    const uint8_t* cursor = data.data();
+    GIPGAUGE_CHECK(!history.load(cursor, data.data() + data.size()));
+    GIPGAUGE_CHECK(cursor == data.data());
+    GIPGAUGE_CHECK(history.getCapacity() == 16);
+    GIPGAUGE_CHECK(history.getSampleNum() == 1);
+    GIPGAUGE_CHECK(history.getLast() == 5.0f);
+}
+
+static std::string writeDashboard(const char* name) {
+    std::string path = std::string("/tmp/gipGaugeSnapshotTest.") + name + ".gipd";
+    gipGaugeDashboard dashboard;
+    gipGauge gauge;
+    fillGauge(gauge, 1.0f);
+    dashboard.addGauge("speed", gauge, 0, 0, 100, 100);
+    dashboard.addGauge("rpm", gauge, 100, 0, 100, 100);
+    dashboard.saveBinary(path);
+    return path;
+}
+
+static std::vector<uint8_t> readFile(const std::string& path) {
+    std::vector<uint8_t> data;
+    FILE* file = std::fopen(path.c_str(), "rb");
+    int c;
+    while ((c = std::fgetc(file)) != EOF) data.push_back(static_cast<uint8_t>(c));
+    std::fclose(file);
+    return data;
+}
+
+static void writeFile(const std::string& path, const std::vector<uint8_t>& data) {
+    FILE* file = std::fopen(path.c_str(), "wb");
+    std::fwrite(data.data(), 1, data.size(), file);
+    std::fclose(file);
+}
+
+GIPGAUGE_TEST(dashboardRejectsCountsThatDoNotFitTheFile) {
+    std::string path = writeDashboard("counts");
+    gipGaugeDashboard dashboard;
+    GIPGAUGE_CHECK(dashboard.loadBinary(path));
+    GIPGAUGE_CHECK(dashboard.getGaugeNum() == 2);
+    std::vector<uint8_t> data = readFile(path);
+
+    // Entry count in header word 4, zone count in word 5
+    for (int word : {4, 5}) {
+        for (uint32_t count : {0xffffffffu, 0x10000000u, 3u}) {
+            std::vector<uint8_t> corrupt = data;
+            std::memcpy(corrupt.data() + word * 4, &count, sizeof(count));
+            writeFile(path, corrupt);
+            GIPGAUGE_CHECK(!dashboard.loadBinary(path));
+            GIPGAUGE_CHECK(dashboard.getGaugeNum() == 2);
+        }
+    }
+
+    data.pop_back();
+    writeFile(path, data);
+    GIPGAUGE_CHECK(!dashboard.loadBinary(path));
+    GIPGAUGE_CHECK(dashboard.getGaugeNum() == 2);
+    std::remove(path.c_str());
+}
+
+GIPGAUGE_TEST_MAIN()
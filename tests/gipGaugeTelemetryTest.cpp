@@ -0,0 +1,175 @@
+/*
+ * gipGaugeTelemetryTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTest.h"
+#include "gipGauge.h"
+#include "gipGaugeTelemetry.h"
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static std::string getSegmentPath(const char* name) {
+    std::string path = "/tmp/gipGaugeTelemetryTest." + std::to_string(getpid()) + "." + name;
+    std::remove(path.c_str());
+    return path;
+}
+
+static long getFileSize(const std::string& path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 ? static_cast<long>(info.st_size) : -1;
+}
+
+GIPGAUGE_TEST(writerReaderRoundTrip) {
+    std::string path = getSegmentPath("roundtrip");
+    gipGaugeTelemetryWriter writer;
+    GIPGAUGE_CHECK(writer.create(path, 3));
+
+    gipGaugeTelemetry reader;
+    GIPGAUGE_CHECK(reader.open(path));
+    GIPGAUGE_CHECK(reader.getSlotNum() == 3);
+    float value = -1.0f;
+    GIPGAUGE_CHECK(reader.read(0, value) == gipGaugeTelemetry::STATUS_ABSENT);
+
+    float values[3] = {1.5f, -2.25f, 1e6f};
+    writer.write(values, 3);
+    for (int i = 0; i < 3; i++) {
+        GIPGAUGE_CHECK(reader.read(i, value) == gipGaugeTelemetry::STATUS_OK);
+        GIPGAUGE_CHECK(value == values[i]);
+    }
+    GIPGAUGE_CHECK(reader.read(3, value) == gipGaugeTelemetry::STATUS_ABSENT);
+    GIPGAUGE_CHECK(reader.getSequence() == 2);
+    std::remove(path.c_str());
+}
+
+GIPGAUGE_TEST(slotSequenceOnlyMovesOnItsOwnWrites) {
+    std::string path = getSegmentPath("sequence");
+    gipGaugeTelemetryWriter writer;
+    GIPGAUGE_CHECK(writer.create(path, 2));
+    gipGaugeTelemetry telemetry;
+    GIPGAUGE_CHECK(telemetry.open(path));
+
+    gipGauge quiet, busy;
+    quiet.setHistorySize(64, 1);
+    busy.setHistorySize(64, 1);
+    quiet.bindTelemetry(&telemetry, 0);
+    busy.bindTelemetry(&telemetry, 1);
+
+    float frame[2] = {10.0f, 20.0f};
+    writer.write(frame, 2);
+    quiet.update();
+    busy.update();
+    for (int i = 0; i < 5; i++) {
+        writer.beginWrite();
+        writer.setValue(1, 30.0f + i);
+        writer.endWrite();
+        quiet.update();
+        busy.update();
+    }
+    GIPGAUGE_CHECK(quiet.getHistory().getSampleNum() == 1);
+    GIPGAUGE_CHECK(busy.getHistory().getSampleNum() == 6);
+    GIPGAUGE_CHECK(busy.getHistory().getLast() == 34.0f);
+    std::remove(path.c_str());
+}
+
+GIPGAUGE_TEST(createTakesOverWithoutResizing) {
+    std::string path = getSegmentPath("takeover");
+    gipGaugeTelemetry reader;
+    long size;
+    {
+        gipGaugeTelemetryWriter first;
+        GIPGAUGE_CHECK(first.create(path, 4));
+        float values[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+        first.write(values, 4);
+        GIPGAUGE_CHECK(reader.open(path));
+        size = getFileSize(path);
+    }
+
+    // A different slot count would resize the segment under the reader
+    gipGaugeTelemetryWriter resized;
+    GIPGAUGE_CHECK(!resized.create(path, 2));
+    GIPGAUGE_CHECK(!resized.create(path, 8));
+    GIPGAUGE_CHECK(getFileSize(path) == size);
+
+    // The same slot count takes over, the reader sees absent until the beat
+    // and a bound gauge records no sample until the new writer writes
+    gipGauge gauge;
+    gauge.setHistorySize(64, 1);
+    gauge.bindTelemetry(&reader, 2);
+    gauge.update();
+    GIPGAUGE_CHECK(gauge.getHistory().getSampleNum() == 1);
+    uint32_t before = 0, after = 0;
+    float value;
+    GIPGAUGE_CHECK(reader.read(2, value, &before) == gipGaugeTelemetry::STATUS_OK);
+    gipGaugeTelemetryWriter second;
+    GIPGAUGE_CHECK(second.create(path, 4));
+    GIPGAUGE_CHECK(getFileSize(path) == size);
+    GIPGAUGE_CHECK(reader.read(2, value) == gipGaugeTelemetry::STATUS_ABSENT);
+    second.heartbeat();
+    GIPGAUGE_CHECK(reader.read(2, value, &after) == gipGaugeTelemetry::STATUS_OK);
+    GIPGAUGE_CHECK(value == 3.0f);
+    GIPGAUGE_CHECK(after == before);
+    gauge.update();
+    GIPGAUGE_CHECK(gauge.getHistory().getSampleNum() == 1);
+    second.beginWrite();
+    second.setValue(2, 5.0f);
+    second.endWrite();
+    gauge.update();
+    GIPGAUGE_CHECK(gauge.getHistory().getSampleNum() == 2);
+    GIPGAUGE_CHECK(gauge.getHistory().getLast() == 5.0f);
+
+    // Files that are not segments are left alone
+    std::string foreign = getSegmentPath("foreign");
+    FILE* file = std::fopen(foreign.c_str(), "wb");
+    for (int i = 0; i < 64; i++) std::fputs("text", file);
+    std::fclose(file);
+    long foreignsize = getFileSize(foreign);
+    GIPGAUGE_CHECK(!second.create(foreign, 4));
+    GIPGAUGE_CHECK(getFileSize(foreign) == foreignsize);
+    std::remove(foreign.c_str());
+    std::remove(path.c_str());
+}
+
+GIPGAUGE_TEST(concurrentWriterIsReadInOrder) {
+    std::string path = getSegmentPath("concurrent");
+    gipGaugeTelemetryWriter writer;
+    GIPGAUGE_CHECK(writer.create(path, 1));
+    gipGaugeTelemetry reader;
+    GIPGAUGE_CHECK(reader.open(path));
+
+    const int writenum = 100000;
+    std::atomic<bool> done(false);
+    std::thread producer([&]() {
+        for (int i = 1; i <= writenum; i++) {
+            float value = static_cast<float>(i);
+            writer.write(&value, 1);
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    // Each newer sequence carries a newer value
+    uint32_t lastsequence = 0;
+    float lastvalue = 0.0f;
+    int reordered = 0;
+    while (!done.load(std::memory_order_acquire)) {
+        float value;
+        uint32_t sequence;
+        if (reader.read(0, value, &sequence) != gipGaugeTelemetry::STATUS_OK) continue;
+        if (sequence != lastsequence && value <= lastvalue) reordered++;
+        lastsequence = sequence;
+        lastvalue = value;
+    }
+    producer.join();
+    GIPGAUGE_CHECK(reordered == 0);
+    float value;
+    GIPGAUGE_CHECK(reader.read(0, value) == gipGaugeTelemetry::STATUS_OK);
+    GIPGAUGE_CHECK(value == static_cast<float>(writenum));
+    std::remove(path.c_str());
+}
+
+GIPGAUGE_TEST_MAIN()
@@ -0,0 +1,82 @@
+/*
+ * gipGaugeTest.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef TESTS_GIPGAUGETEST_H_
+#define TESTS_GIPGAUGETEST_H_
+
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Minimal self-contained test runner, one executable per test file. Each test
+// registers itself with GIPGAUGE_TEST, failed checks are reported and counted
+// and the process exits non-zero if any check failed.
+class gipGaugeTest {
+public:
+    static int add(const char* name, std::function<void()> body) {
+        getTests().push_back(Test{name, body});
+        return 0;
+    }
+
+    static void fail(const char* file, int line, const std::string& message) {
+        std::fprintf(stderr, "%s:%d: %s\n", file, line, message.c_str());
+        getFailures()++;
+    }
+
+    static int runAll(int argc, char** argv) {
+        std::string filter = argc > 1 ? argv[1] : "";
+        int failedtests = 0;
+        for (const Test& test : getTests()) {
+            if (!filter.empty() && test.name.find(filter) == std::string::npos) continue;
+            int failures = getFailures();
+            test.body();
+            bool passed = getFailures() == failures;
+            if (!passed) failedtests++;
+            std::printf("%-6s %s\n", passed ? "ok" : "FAIL", test.name.c_str());
+        }
+        return failedtests > 0 ? 1 : 0;
+    }
+
+private:
+    struct Test {
+        std::string name;
+        std::function<void()> body;
+    };
+
+    static std::vector<Test>& getTests() {
+        static std::vector<Test> tests;
+        return tests;
+    }
+
+    static int& getFailures() {
+        static int failures = 0;
+        return failures;
+    }
+};
+
+#define GIPGAUGE_TEST(name) \
+    static void name(); \
+    static int name##registration = gipGaugeTest::add(#name, name); \
+    static void name()
+
+#define GIPGAUGE_CHECK(condition) \
+    do { if (!(condition)) gipGaugeTest::fail(__FILE__, __LINE__, "check failed: " #condition); } while (0)
+
+#define GIPGAUGE_CHECK_NEAR(actual, expected, tolerance) \
+    do { \
+        double a_ = (actual), e_ = (expected); \
+        if (!(std::fabs(a_ - e_) <= (tolerance))) { \
+            gipGaugeTest::fail(__FILE__, __LINE__, std::string(#actual " = ") + std::to_string(a_) + \
+                    ", expected " + std::to_string(e_) + " within " #tolerance); \
+        } \
+    } while (0)
+
+#define GIPGAUGE_TEST_MAIN() \
+    int main(int argc, char** argv) { return gipGaugeTest::runAll(argc, argv); }
+
+#endif /* TESTS_GIPGAUGETEST_H_ */
@@ -0,0 +1,114 @@
+/*
+ * gipGaugeThreadPoolTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTest.h"
+#include "gipGauge.h"
+#include "gipGaugeBatch.h"
+#include "gipGaugeDrawList.h"
+#include "gipGaugeThreadPool.h"
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+GIPGAUGE_TEST(parallelForCoversEveryIndexOnce) {
+    gipGaugeThreadPool pool(3);
+    GIPGAUGE_CHECK(pool.getThreadNum() == 4);
+    const int counts[] = {1, 7, 64, 1001};
+    const int grains[] = {1, 2, 5, 64, 2000};
+    for (int count : counts) {
+        for (int grain : grains) {
+            std::vector<std::atomic<int>> hits(count);
+            for (std::atomic<int>& hit : hits) hit = 0;
+            pool.parallelFor(count, [&](int i) {
+                // Uneven work, every 16th index is much slower
+                volatile float sink = 0.0f;
+                int work = i % 16 == 0 ? 20000 : 10;
+                for (int k = 0; k < work; k++) sink = sink + k;
+                hits[i]++;
+            }, grain);
+            bool once = true;
+            for (std::atomic<int>& hit : hits) once = once && hit == 1;
+            GIPGAUGE_CHECK(once);
+        }
+    }
+}
+
+GIPGAUGE_TEST(backToBackLoopsComplete) {
+    gipGaugeThreadPool pool(2);
+    std::atomic<long long> sum(0);
+    for (int loop = 0; loop < 500; loop++) {
+        sum = 0;
+        pool.parallelFor(100, [&](int i) { sum += i; }, 3);
+        if (sum != 4950) break;
+    }
+    GIPGAUGE_CHECK(sum == 4950);
+}
+
+GIPGAUGE_TEST(exceptionReachesTheCaller) {
+    gipGaugeThreadPool pool(3);
+    bool caught = false;
+    try {
+        pool.parallelFor(200, [](int i) {
+            if (i == 117) throw std::runtime_error("body failed");
+        }, 4);
+    } catch (const std::runtime_error& error) {
+        caught = std::string(error.what()) == "body failed";
+    }
+    GIPGAUGE_CHECK(caught);
+
+    // The pool stays usable afterwards
+    std::atomic<int> calls(0);
+    pool.parallelFor(50, [&](int) { calls++; });
+    GIPGAUGE_CHECK(calls == 50);
+}
+
+static std::string drawDashboard(gipGaugeThreadPool* pool, uint64_t& allocations) {
+    std::vector<std::unique_ptr<gipGauge>> gauges;
+    gipGaugeDrawList list;
+    gipGaugeBatch batch;
+    batch.setBackend(&list);
+    batch.setThreadPool(pool);
+    for (int i = 0; i < 24; i++) {
+        gauges.emplace_back(new gipGauge());
+        gipGauge& gauge = *gauges.back();
+        gauge.setGaugeType(static_cast<gipGauge::GaugeType>(i % 4));
+        gauge.setValueRange(0.0f, 100.0f * (1 + i % 5));
+        gauge.setTitle("gauge " + std::to_string(i));
+        gauge.setAnimationEnabled(false);
+        gauge.setValue(7.0f * i);
+        batch.addGauge(&gauge, (i % 6) * 160, (i / 6) * 160, 150, 150);
+    }
+    std::string output;
+    allocations = 0;
+    for (int frame = 0; frame < 2; frame++) {
+        // Resizing makes every gauge stale again
+        for (int i = 0; i < 24; i++) {
+            batch.setGaugeRect(gauges[i].get(), (i % 6) * 160, (i / 6) * 160, 150 - 20 * frame, 150);
+        }
+        list.clear();
+        batch.draw();
+        output += list.toString();
+        allocations += batch.getFrameCounters().bufferallocations;
+    }
+    return output;
+}
+
+GIPGAUGE_TEST(batchOutputDoesNotDependOnPool) {
+    gipGaugeThreadPool pool(3);
+    uint64_t serialallocations, parallelallocations;
+    std::string serial = drawDashboard(nullptr, serialallocations);
+    std::string parallel = drawDashboard(&pool, parallelallocations);
+    GIPGAUGE_CHECK(!serial.empty());
+    GIPGAUGE_CHECK(parallel == serial);
+    // Allocations made on the workers are counted as well, the pool path
+    // only adds its list of stale gauges
+    GIPGAUGE_CHECK(parallelallocations >= serialallocations);
+    GIPGAUGE_CHECK((serialallocations > 0) == gipGaugeCounters::isEnabled());
+}
+
+GIPGAUGE_TEST_MAIN()
@@ -0,0 +1,152 @@
+/*
+ * gipGaugeTickKernelTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "gipGaugeTest.h"
+#include "gipGauge.h"
+#include "gipGaugeDrawList.h"
+#include "gipGaugeGeometry.h"
+#include "gipGaugeTickKernel.h"
+#include <cmath>
+#include <vector>
+
+// The rotation recurrence runs in float for up to RESEED_INTERVAL / 4 steps
+// between exact seeds. Unit vectors stay within 1e-5 of std::cos/std::sin,
+// so endpoints stay within 1e-5 of the radius plus float rounding of the
+// coordinates themselves.
+static const double DIRECTION_TOLERANCE = 1e-5;
+
+static double getEndpointTolerance(float radius, float center) {
+    return DIRECTION_TOLERANCE * radius + 4.0 * center * 1.2e-7;
+}
+
+GIPGAUGE_TEST(directionsMatchCosSinAcrossReseeds) {
+    const double torad = M_PI / 180.0;
+    // Counts around the SIMD width and the every-64 reseed boundary
+    for (int count : {1, 3, 4, 5, 63, 64, 65, 67, 127, 128, 129, 200, 1001}) {
+        for (double start : {225.0, 180.0, -30.0}) {
+            double step = 270.0 / count;
+            std::vector<float> cosines(count), sines(count);
+            gipGaugeTickKernel::directions(start, step, count, cosines.data(), sines.data());
+            double worst = 0.0;
+            for (int i = 0; i < count; i++) {
+                worst = std::max(worst, std::fabs(cosines[i] - std::cos((start + i * step) * torad)));
+                worst = std::max(worst, std::fabs(sines[i] - std::sin((start + i * step) * torad)));
+            }
+            GIPGAUGE_CHECK_NEAR(worst, 0.0, DIRECTION_TOLERANCE);
+        }
+    }
+}
+
+GIPGAUGE_TEST(endpointsMatchScalarFormula) {
+    const int count = 131;
+    std::vector<float> cosines(count), sines(count);
+    gipGaugeTickKernel::directions(225.0, 270.0 / (count - 1), count, cosines.data(), sines.data());
+    gipGaugeTickArrays ticks;
+    ticks.x1.push_back(1.0f);   // Existing entries are kept, new ones appended
+    ticks.y1.push_back(2.0f);
+    ticks.x2.push_back(3.0f);
+    ticks.y2.push_back(4.0f);
+    gipGaugeTickKernel::endpoints(cosines.data(), sines.data(), count, 300.0f, 200.0f, 85.0f, 95.0f, ticks);
+    GIPGAUGE_CHECK(ticks.size() == count + 1);
+    GIPGAUGE_CHECK(ticks.x1[0] == 1.0f && ticks.y2[0] == 4.0f);
+    for (int i = 0; i < count; i++) {
+        GIPGAUGE_CHECK(ticks.x1[i + 1] == 300.0f + 85.0f * cosines[i]);
+        GIPGAUGE_CHECK(ticks.y1[i + 1] == 200.0f + 85.0f * sines[i]);
+        GIPGAUGE_CHECK(ticks.x2[i + 1] == 300.0f + 95.0f * cosines[i]);
+        GIPGAUGE_CHECK(ticks.y2[i + 1] == 200.0f + 95.0f * sines[i]);
+    }
+}
+
+struct gipGaugeTickLine {
+    float x1, y1, x2, y2;
+};
+
+// Tick lines as the gauge computed them before the kernel: one value per
+// tick, mapped to an angle and through std::cos/std::sin
+template<typename Policy>
+static std::vector<gipGaugeTickLine> getReferenceTicks(float minValue, float maxValue, int majorCount, int minorCount,
+                                                       int x, int y, int w, int h) {
+    typedef gipGaugeGeometry<Policy> geometry;
+    float centerX, centerY, radius;
+    Policy::layout(x, y, w, h, centerX, centerY, radius);
+
+    std::vector<float> majorValues, minorValues;
+    for (int i = 0; i <= majorCount; i++) majorValues.push_back(minValue + (maxValue - minValue) * i / majorCount);
+    float majorInterval = (maxValue - minValue) / majorCount;
+    float minorInterval = majorInterval / (minorCount + 1);
+    for (int i = 0; i < majorCount; i++) {
+        for (int j = 1; j <= minorCount; j++) {
+            float minorValue = minValue + majorInterval * i + minorInterval * j;
+            if (minorValue < maxValue) minorValues.push_back(minorValue);
+        }
+    }
+
+    std::vector<gipGaugeTickLine> lines;
+    const std::vector<float>* groups[2] = {&majorValues, &minorValues};
+    const float innerRadii[2] = {radius * 0.85f, radius * 0.9f};
+    for (int g = 0; g < 2; g++) {
+        for (float value : *groups[g]) {
+            float angle = geometry::valueToAngle(value, minValue, maxValue);
+            float cos_a = std::cos(angle * M_PI / 180.0f);
+            float sin_a = std::sin(angle * M_PI / 180.0f);
+            float outerRadius = radius * 0.95f;
+            lines.push_back({centerX + innerRadii[g] * cos_a, centerY + innerRadii[g] * sin_a,
+                             centerX + outerRadius * cos_a, centerY + outerRadius * sin_a});
+        }
+    }
+    return lines;
+}
+
+template<typename Policy>
+static void checkGaugeTicks(gipGauge::GaugeType type, float minValue, float maxValue, int majorCount, int minorCount, int size) {
+    gipGauge gauge;
+    gauge.setGaugeType(type);
+    gauge.setValueRange(minValue, maxValue);
+    gauge.setMajorTickCount(majorCount);
+    gauge.setMinorTickCount(minorCount);
+    gauge.setShowTickLabels(false);
+    gauge.setLodEnabled(false);
+    gipGaugeDrawList list;
+    gauge.setBackend(&list);
+    gauge.draw(10, 20, size, size);
+
+    std::vector<gipGaugeTickLine> lines;
+    for (const gipGaugeDrawList::Command& command : list.getCommands()) {
+        if (command.type != gipGaugeDrawList::COMMAND_LINE || command.layer != gipGaugeBackend::LAYER_TICKS) continue;
+        lines.push_back({command.p[0], command.p[1], command.p[2], command.p[3]});
+    }
+
+    std::vector<gipGaugeTickLine> reference = getReferenceTicks<Policy>(minValue, maxValue, majorCount, minorCount,
+                                                                          10, 20, size, size);
+    GIPGAUGE_CHECK(lines.size() == reference.size());
+    float centerX, centerY, radius;
+    Policy::layout(10, 20, size, size, centerX, centerY, radius);
+    double tolerance = getEndpointTolerance(radius, std::max(centerX, centerY));
+    double worst = 0.0;
+    for (size_t i = 0; i < std::min(lines.size(), reference.size()); i++) {
+        worst = std::max(worst, static_cast<double>(std::fabs(lines[i].x1 - reference[i].x1)));
+        worst = std::max(worst, static_cast<double>(std::fabs(lines[i].y1 - reference[i].y1)));
+        worst = std::max(worst, static_cast<double>(std::fabs(lines[i].x2 - reference[i].x2)));
+        worst = std::max(worst, static_cast<double>(std::fabs(lines[i].y2 - reference[i].y2)));
+    }
+    GIPGAUGE_CHECK_NEAR(worst, 0.0, tolerance);
+}
+
+GIPGAUGE_TEST(gaugeTicksMatchCosSinGeometry) {
+    for (int size : {300, 4000}) {
+        // Full dial, and a semicircle, each with fewer and more than 64 ticks
+        // in the major and the fine minor progressions
+        checkGaugeTicks<gipGaugeCircularPolicy>(gipGauge::GAUGE_CIRCULAR, 0.0f, 100.0f, 10, 4, size);
+        checkGaugeTicks<gipGaugeCircularPolicy>(gipGauge::GAUGE_CIRCULAR, 0.0f, 100.0f, 10, 19, size);
+        checkGaugeTicks<gipGaugeCircularPolicy>(gipGauge::GAUGE_CIRCULAR, -50.0f, 50.0f, 65, 1, size);
+        checkGaugeTicks<gipGaugeSemicirclePolicy>(gipGauge::GAUGE_SEMICIRCLE, 0.0f, 100.0f, 8, 7, size);
+        checkGaugeTicks<gipGaugeSemicirclePolicy>(gipGauge::GAUGE_SEMICIRCLE, 0.0f, 6400.0f, 64, 3, size);
+    }
+    // Degenerate range, every major tick at the end of the sweep and no minor ticks
+    checkGaugeTicks<gipGaugeCircularPolicy>(gipGauge::GAUGE_CIRCULAR, 50.0f, 50.0f, 10, 4, 300);
+}
+
+GIPGAUGE_TEST_MAIN()